@@ -0,0 +1,129 @@
+// Frame codec matrix: encode and decode cost per sample and bytes per sample for
+// every --codec choice. Arguments are codec (0 protobuf, 1 protobuf + Gorilla,
+// 2 cdr, 3 fixed, 4 schema) and readings per frame. Readings look like the
+// simulated sensors: a few channels on a 100 ms period with slowly moving values.
+// The Record benchmarks compare one proto_reading through the generated code
+// (sensor.pb.cc) with the compile-time schema codec.
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <vector>
+#include "src/Serializer/frame_codec.h"
+#include "src/Serializer/frame_decoder.h"
+#include "src/Serializer/schema_codec.h"
+#include "sensor.pb.h"
+
+static frameEncoder make_encoder(int64_t variant){
+    switch (variant) {
+        case 0: return frameEncoder(frameCodec::Protobuf);
+        case 1: return frameEncoder(frameCodec::Protobuf, true);
+        case 2: return frameEncoder(frameCodec::Cdr);
+        case 3: return frameEncoder(frameCodec::Fixed);
+        default: return frameEncoder(frameCodec::Schema);
+    }
+}
+
+static void fill(frameEncoder& encoder, int64_t readings, int64_t& seq){
+    for (int64_t i = 0; i < readings; ++i, ++seq) {
+        const uint32_t channel = static_cast<uint32_t>(seq % 3);
+        encoder.add(channel, 20.0 + channel * 100.0 + static_cast<double>((seq / 30) % 40) * 0.5,
+                    1736503200000 + (seq / 3) * 100, seq / 3);
+    }
+}
+
+static void report(benchmark::State& state, size_t bytes){
+    const double samples = static_cast<double>(state.iterations() * state.range(1));
+    state.SetItemsProcessed(state.iterations() * state.range(1));
+    state.counters["ns/sample"] = benchmark::Counter(samples, benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+    state.counters["bytes/sample"] = static_cast<double>(bytes) / state.range(1);
+    state.SetLabel(state.range(0) == 1 ? "protobuf+gorilla" : frame_codec_name(make_encoder(state.range(0)).codec()));
+}
+
+static void BM_Encode(benchmark::State& state){
+    frameEncoder encoder = make_encoder(state.range(0));
+    std::vector<uint8_t> dds_bytes;
+    int64_t seq = 0;
+    for (auto _ : state) {
+        fill(encoder, state.range(1), seq);
+        dds_bytes.resize(encoder.encoded_size());
+        encoder.write_to(dds_bytes.data());
+        benchmark::DoNotOptimize(dds_bytes.data());
+    }
+    report(state, dds_bytes.size());
+}
+
+static void BM_Decode(benchmark::State& state){
+    frameEncoder encoder = make_encoder(state.range(0));
+    frameDecoder decoder(encoder.codec());
+    std::vector<uint8_t> dds_bytes;
+    std::vector<sensorRecord> records;
+    int64_t seq = 0;
+    fill(encoder, state.range(1), seq);
+    encoder.finish(dds_bytes);
+    for (auto _ : state) {
+        decoder.decode(dds_bytes.data(), dds_bytes.size(), records);
+        benchmark::DoNotOptimize(records.data());
+    }
+    report(state, dds_bytes.size());
+}
+
+BENCHMARK(BM_Encode)->ArgsProduct({{0, 1, 2, 3, 4}, {1, 256}});
+BENCHMARK(BM_Decode)->ArgsProduct({{0, 1, 2, 3, 4}, {1, 256}});
+
+static frameReading record_at(int64_t i){
+    return frameReading{static_cast<uint32_t>(i % 3 + 1), 20.0 + static_cast<double>(i % 40) * 0.5,
+                        1736503200000 + i * 100, i + 1};
+}
+
+static void BM_RecordEncodeGenerated(benchmark::State& state){
+    sensor_proto::proto_reading msg;
+    uint8_t bytes[64];
+    int64_t i = 0;
+    for (auto _ : state) {
+        const frameReading r = record_at(i++);
+        msg.set_channel(r.channel);
+        msg.set_value(r.value);
+        msg.set_timestamp(r.timestamp);
+        msg.set_sequence_num(r.sequence_num);
+        benchmark::DoNotOptimize(msg.ByteSizeLong());
+        msg.SerializeWithCachedSizesToArray(bytes);
+        benchmark::DoNotOptimize(bytes);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RecordEncodeGenerated);
+
+static void BM_RecordEncodeSchema(benchmark::State& state){
+    uint8_t bytes[readingSchema::max_size];
+    int64_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(readingSchema::encode(record_at(i++), bytes));
+        benchmark::DoNotOptimize(bytes);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RecordEncodeSchema);
+
+static void BM_RecordDecodeGenerated(benchmark::State& state){
+    uint8_t bytes[readingSchema::max_size];
+    readingSchema::encode(record_at(5), bytes);
+    sensor_proto::proto_reading msg;
+    for (auto _ : state) {
+        msg.ParseFromArray(bytes, sizeof bytes);
+        benchmark::DoNotOptimize(msg.sequence_num());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RecordDecodeGenerated);
+
+static void BM_RecordDecodeSchema(benchmark::State& state){
+    uint8_t bytes[readingSchema::max_size];
+    readingSchema::encode(record_at(5), bytes);
+    frameReading r;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(bytes);
+        readingSchema::decode(bytes, sizeof bytes, r);
+        benchmark::DoNotOptimize(r);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RecordDecodeSchema);
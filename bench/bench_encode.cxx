@@ -0,0 +1,72 @@
+// Cost of getting one encoded frame into the DDS sample's octet vector.
+//   StringThenCopy : SerializeToString into a std::string, then assign() into the vector
+//   Direct         : ByteSizeLong, then serialize with the cached sizes straight into the vector
+//   ArenaPerFrame  : Direct, with the frame built on a reused google::protobuf::Arena
+// Argument is readings per frame (1 = the old one-reading-per-sample layout).
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <google/protobuf/arena.h>
+#include "sensor.pb.h"
+
+static void fill_frame(sensor_proto::proto_frame& frame, int64_t readings, int64_t& seq){
+    frame.add_sensors("Temp-Sensor");
+    frame.add_sensors("Press-Sensor");
+    for (int64_t i = 0; i < readings; ++i, ++seq) {
+        frame.add_sensor_index(static_cast<uint32_t>(seq & 1));
+        frame.add_value(20.0 + static_cast<double>(seq % 80));
+        frame.add_timestamp(1736503200000 + seq * 10);
+        frame.add_sequence_num(seq);
+    }
+}
+
+static void BM_EncodeStringThenCopy(benchmark::State& state){
+    sensor_proto::proto_frame frame;
+    std::string buffer;
+    std::vector<uint8_t> dds_bytes;
+    int64_t seq = 0;
+    for (auto _ : state) {
+        frame.Clear();
+        fill_frame(frame, state.range(0), seq);
+        frame.SerializeToString(&buffer);
+        dds_bytes.assign(buffer.begin(), buffer.end());
+        benchmark::DoNotOptimize(dds_bytes.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_EncodeStringThenCopy)->Arg(1)->Arg(256);
+
+static void BM_EncodeDirect(benchmark::State& state){
+    sensor_proto::proto_frame frame;
+    std::vector<uint8_t> dds_bytes;
+    int64_t seq = 0;
+    for (auto _ : state) {
+        frame.Clear();
+        fill_frame(frame, state.range(0), seq);
+        dds_bytes.resize(frame.ByteSizeLong());
+        frame.SerializeWithCachedSizesToArray(dds_bytes.data());
+        benchmark::DoNotOptimize(dds_bytes.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_EncodeDirect)->Arg(1)->Arg(256);
+
+static void BM_EncodeArenaPerFrame(benchmark::State& state){
+    google::protobuf::ArenaOptions options;
+    options.start_block_size = 16 * 1024;
+    google::protobuf::Arena arena(options);
+    std::vector<uint8_t> dds_bytes;
+    int64_t seq = 0;
+    for (auto _ : state) {
+        auto* frame = google::protobuf::Arena::CreateMessage<sensor_proto::proto_frame>(&arena);
+        fill_frame(*frame, state.range(0), seq);
+        dds_bytes.resize(frame->ByteSizeLong());
+        frame->SerializeWithCachedSizesToArray(dds_bytes.data());
+        benchmark::DoNotOptimize(dds_bytes.data());
+        // Reset keeps the first block, so steady state does not go back to malloc
+        arena.Reset();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_EncodeArenaPerFrame)->Arg(1)->Arg(256);
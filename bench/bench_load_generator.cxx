@@ -0,0 +1,72 @@
+// Synthetic readings/s: value generation alone per distribution, then full
+// readings built into an SPSC link the way the publisher's load generator does.
+#include <benchmark/benchmark.h>
+#include <random>
+#include <string>
+#include <vector>
+#include "src/common/utilities/fast_random.h"
+#include "src/common/utilities/load_generator.h"
+#include "src/common/utilities/spsc_ring_buffer.h"
+
+static void BM_LoadValues(benchmark::State& state){
+    valueDistribution dist;
+    dist.shape = static_cast<valueShape>(state.range(0));
+    dist.a = 500.0;
+    dist.b = 50.0;
+    loadGenerator generator(dist);
+    std::vector<double> batch(256);
+    for (auto _ : state) {
+        generator.generate(batch);
+        benchmark::DoNotOptimize(batch.data());
+    }
+    state.SetItemsProcessed(state.iterations() * batch.size());
+}
+BENCHMARK(BM_LoadValues)->Arg(int(valueShape::Uniform))->Arg(int(valueShape::Normal))
+                        ->Arg(int(valueShape::RandomWalk))->Arg(int(valueShape::Sine));
+
+// Baseline: what the simulated sensors used to do per reading
+static void BM_RandomDeviceUniform(benchmark::State& state){
+    std::random_device rd;
+    std::uniform_real_distribution<double> dist(450.0, 550.0);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dist(rd));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RandomDeviceUniform);
+
+struct loadReading {
+    std::string sensor_id;
+    double value;
+    int64_t timestamp;
+    uint32_t sequence_num;
+};
+
+static void BM_LoadIntoLink(benchmark::State& state){
+    loadGenerator generator({valueShape::Normal, 500.0, 50.0});
+    spscRingBuffer<loadReading> link(4096);
+    std::vector<std::string> names;
+    for (int c = 0; c < 64; ++c) names.push_back("Load-0-" + std::to_string(c));
+    std::vector<double> batch(256);
+    std::vector<loadReading> drained;
+    drained.reserve(4096);
+    size_t channel = 0;
+    uint32_t seq = 0;
+    for (auto _ : state) {
+        generator.generate(batch);
+        for (double value : batch) {
+            link.push_with([&](loadReading& slot){
+                slot.sensor_id = names[channel];
+                slot.value = value;
+                slot.timestamp = 0;
+                slot.sequence_num = seq++;
+            });
+            channel = (channel + 1) % names.size();
+        }
+        // Stand-in consumer, keeps the link from filling up
+        drained.clear();
+        link.drain_into(drained);
+    }
+    state.SetItemsProcessed(state.iterations() * batch.size());
+}
+BENCHMARK(BM_LoadIntoLink);
@@ -0,0 +1,94 @@
+// A local writer/reader pair on one participant under each built-in telemetry QoS
+// profile: frames/s written, one-way latency percentiles and loss. Frames cycle
+// over BENCH_CHANNELS keyed instances and are the size of a full fixed-codec
+// frame; the first 8 bytes carry the send time.
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <thread>
+#include "dds/dds.hpp"
+#include "Sensor_wrapper.hpp"
+#include "src/common/utilities/dds_qos.h"
+#include "src/common/utilities/sensor_scheduler.h"
+#include "src/Serializer/frame_codec.h"
+
+static const char* const BENCH_PROFILES[] = {
+    qosProfileSet::TELEMETRY_BEST_EFFORT,
+    qosProfileSet::TELEMETRY_RELIABLE,
+    qosProfileSet::LATE_JOIN_SNAPSHOT,
+};
+static const uint32_t BENCH_CHANNELS = 16;
+static const size_t BENCH_FRAME_BYTES = frame_wire::FIXED_HEADER + 256 * frame_wire::FIXED_RECORD;
+
+static void BM_QosProfile(benchmark::State& state){
+    const qosProfileSet profiles;
+    const qosProfile& profile = *profiles.find(BENCH_PROFILES[state.range(0)]);
+
+    dds::domain::DomainParticipant participant(org::eclipse::cyclonedds::domain::default_id());
+    dds::topic::Topic<SensorData::ChannelFrame> topic(participant, "BENCH-QOS-" + profile.name);
+    dds::sub::Subscriber subscriber(participant);
+    dds::pub::Publisher publisher(participant);
+    dds::sub::DataReader<SensorData::ChannelFrame> reader(subscriber, topic,
+        make_dds_qos<dds::sub::qos::DataReaderQos>(profile));
+    dds::pub::DataWriter<SensorData::ChannelFrame> writer(publisher, topic,
+        make_dds_qos<dds::pub::qos::DataWriterQos>(profile));
+
+    // Discovery is asynchronous even within one participant
+    const auto match_deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (writer.publication_matched_status().current_count() == 0) {
+        if (std::chrono::steady_clock::now() > match_deadline) {
+            state.SkipWithError("reader never matched");
+            return;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    std::atomic<bool> done{false};
+    std::atomic<uint64_t> received{0};
+    jitterHistogram latency;
+    std::thread reader_thread([&]{
+        while (!done.load(std::memory_order_acquire)) {
+            for (const auto& sample : reader.take()) {
+                if (!sample.info().valid()) continue;
+                int64_t sent_ns;
+                std::memcpy(&sent_ns, sample.data().data().data(), sizeof sent_ns);
+                latency.record(scheduler_clock_ns() - sent_ns);
+                received.fetch_add(1, std::memory_order_relaxed);
+            }
+            std::this_thread::yield();
+        }
+    });
+
+    SensorData::ChannelFrame frame;
+    frame.data().resize(BENCH_FRAME_BYTES);
+    uint64_t sent = 0;
+    for (auto _ : state) {
+        frame.channel(static_cast<uint32_t>(sent % BENCH_CHANNELS));
+        const int64_t now_ns = scheduler_clock_ns();
+        std::memcpy(frame.data().data(), &now_ns, sizeof now_ns);
+        writer.write(frame);
+        sent++;
+    }
+
+    // Frames still in flight count as delivered if they land within a second
+    const auto drain_deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+    while (received.load() < sent && std::chrono::steady_clock::now() < drain_deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    done.store(true, std::memory_order_release);
+    reader_thread.join();
+
+    const jitterSnapshot lat = latency.snapshot();
+    const uint64_t delivered = received.load();
+    state.counters["frames/s"] = benchmark::Counter(static_cast<double>(sent), benchmark::Counter::kIsRate);
+    state.counters["p50_us"] = static_cast<double>(lat.p50_ns) / 1000.0;
+    state.counters["p99_us"] = static_cast<double>(lat.p99_ns) / 1000.0;
+    state.counters["max_us"] = static_cast<double>(lat.max_ns) / 1000.0;
+    state.counters["loss_%"] = sent ? 100.0 * static_cast<double>(sent - std::min(sent, delivered)) / sent : 0.0;
+    state.SetBytesProcessed(static_cast<int64_t>(sent * BENCH_FRAME_BYTES));
+    state.SetLabel(profile.name);
+}
+BENCHMARK(BM_QosProfile)->DenseRange(0, 2)->UseRealTime();
@@ -0,0 +1,67 @@
+// Samples/s through shardedAggregator against worker count.
+// Each sample pays for a protobuf encode, like the publisher's publish step.
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include "src/common/utilities/sharded_aggregator.h"
+#include "sensor.pb.h"
+
+struct BenchMsg {
+    uint32_t channel;
+    double value;
+    int64_t timestamp;
+    int64_t sequence_num;
+};
+
+static void BM_ShardedAggregation(benchmark::State& state){
+    const size_t workers = size_t(state.range(0));
+    const size_t channels = 1024;
+    const size_t samples_per_round = 64 * 1024;
+
+    struct encodeState {
+        sensor_proto::proto_serial_data proto_msg;
+        std::string buffer;
+    };
+    std::vector<encodeState> encoders(workers);
+    std::vector<std::string> names(channels);
+    for (size_t c = 0; c < channels; ++c) names[c] = "Sensor-" + std::to_string(c);
+    std::atomic<uint64_t> processed{0};
+
+    shardedAggregator<BenchMsg> pool(workers, [&](size_t worker, size_t channel, std::vector<BenchMsg>& batch){
+        encodeState& enc = encoders[worker];
+        for (const auto& msg : batch) {
+            enc.proto_msg.set_sensor_id(names[channel]);
+            enc.proto_msg.set_value(msg.value);
+            enc.proto_msg.set_timestamp(msg.timestamp);
+            enc.proto_msg.set_sequence_num(msg.sequence_num);
+            enc.proto_msg.SerializeToString(&enc.buffer);
+            benchmark::DoNotOptimize(enc.buffer.data());
+        }
+        processed.fetch_add(batch.size(), std::memory_order_relaxed);
+    });
+    for (size_t c = 0; c < channels; ++c) pool.add_channel(c);
+    pool.start();
+
+    uint64_t submitted = 0;
+    int64_t seq = 0;
+    for (auto _ : state) {
+        for (size_t i = 0; i < samples_per_round; ++i) {
+            const size_t c = i % channels;
+            BenchMsg msg{uint32_t(c), 21.5, 1765004977882 + seq, seq};
+            while (!pool.submit(c, std::move(msg))) std::this_thread::yield();
+        }
+        seq++;
+        submitted += samples_per_round;
+        while (processed.load(std::memory_order_relaxed) < submitted) std::this_thread::yield();
+    }
+    pool.stop();
+
+    uint64_t stolen = 0;
+    for (size_t w = 0; w < pool.worker_count(); ++w) stolen += pool.stats(w).stolen;
+    state.SetItemsProcessed(int64_t(submitted));
+    state.counters["workers"] = double(workers);
+    state.counters["steals"] = double(stolen);
+}
+BENCHMARK(BM_ShardedAggregation)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime()->Unit(benchmark::kMillisecond);
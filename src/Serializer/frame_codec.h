@@ -0,0 +1,207 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "sensor.pb.h"
+#include "utilities/gorilla_codec.h"
+#include "utilities/little_endian.h"
+#include "schema_codec.h"
+
+// Wire format of a telemetry frame inside the ChannelFrame octets. Publisher and
+// subscriber pick the same one at startup (--codec).
+enum class frameCodec {
+    Protobuf,   // proto_frame columns, optionally a Gorilla block (--compress)
+    Cdr,        // SensorData::ReadingFrame as plain little-endian CDR, the layout DDS uses for the IDL type
+    Fixed,      // count, then 28-byte little-endian records
+    Schema      // proto_frame.readings only, laid out by the compile-time schema codec
+};
+
+inline const char* frame_codec_name(frameCodec codec){
+    switch (codec) {
+        case frameCodec::Protobuf: return "protobuf";
+        case frameCodec::Cdr: return "cdr";
+        case frameCodec::Fixed: return "fixed";
+        case frameCodec::Schema: return "schema";
+    }
+    return "?";
+}
+
+inline bool parse_frame_codec(const std::string& name, frameCodec& codec){
+    for (frameCodec c : {frameCodec::Protobuf, frameCodec::Cdr, frameCodec::Fixed, frameCodec::Schema}) {
+        if (name == frame_codec_name(c)) {
+            codec = c;
+            return true;
+        }
+    }
+    return false;
+}
+
+// One reading handed to the encoder
+struct frameReading {
+    uint32_t channel;
+    double value;
+    int64_t timestamp;
+    int64_t sequence_num;
+};
+
+// proto_reading (sensor.proto) as a compile-time schema over frameReading
+using readingSchema = recordSchema<
+    schemaField<1, &frameReading::channel, wireType::Fixed32>,
+    schemaField<2, &frameReading::value, wireType::Fixed64>,
+    schemaField<3, &frameReading::timestamp, wireType::Fixed64>,
+    schemaField<4, &frameReading::sequence_num, wireType::Fixed64>>;
+
+// Wire constants of the Cdr, Fixed and Schema layouts. CDR alignment is relative to the
+// end of the encapsulation header.
+namespace frame_wire {
+
+// Fixed: uint32 count, then per reading uint32 channel, double value, int64 ts, int64 seq
+constexpr size_t FIXED_HEADER = 4;
+constexpr size_t FIXED_RECORD = 28;
+
+// Cdr: encapsulation {0x00, 0x01 (CDR_LE), options 0, 0}, uint32 sequence length,
+// then each Reading aligned member by member. After the first reading every one
+// occupies 32 bytes: channel, 4 bytes of padding, value, timeStamp, sequence_num.
+constexpr uint8_t CDR_LE_ENCAPSULATION[4] = {0x00, 0x01, 0x00, 0x00};
+constexpr size_t CDR_HEADER = 4;
+constexpr size_t CDR_READING = 32;
+
+inline size_t cdr_size(size_t count){
+    return CDR_HEADER + (count == 0 ? 4 : count * CDR_READING);
+}
+
+// Body offset of reading i's channel; its value, timeStamp and sequence_num start at 8 + 32 i
+inline size_t cdr_channel_offset(size_t i){
+    return i == 0 ? 4 : i * CDR_READING;
+}
+
+// Schema: each reading is a proto_frame.readings entry, tag 7/length-delimited,
+// a one-byte length and readingSchema's fixed 32 bytes
+constexpr uint8_t SCHEMA_READING_TAG = (7 << 3) | 2;
+static_assert(readingSchema::fixed_size && readingSchema::max_size < 0x80, "one-byte entry length");
+constexpr size_t SCHEMA_ENTRY = 2 + readingSchema::max_size;
+
+}  // namespace frame_wire
+
+// Builds one frame at a time in the chosen codec. State is reused from frame to
+// frame: encoded_size() followed by write_to() serializes straight into the
+// caller's buffer (e.g. the DDS sample) and starts the next frame.
+class frameEncoder {
+private:
+    frameCodec m_codec;
+    bool m_compress;
+    sensor_proto::proto_frame m_frame;
+    gorillaBlockEncoder m_gorilla;
+    std::vector<frameReading> m_pending;   // Cdr, Fixed and Schema are laid out at write time
+    size_t m_count = 0;
+
+    void write_cdr(uint8_t* out) const {
+        using namespace frame_wire;
+        std::memcpy(out, CDR_LE_ENCAPSULATION, CDR_HEADER);
+        uint8_t* body = out + CDR_HEADER;
+        le_store32(body, static_cast<uint32_t>(m_pending.size()));
+        for (size_t i = 0; i < m_pending.size(); ++i) {
+            const frameReading& r = m_pending[i];
+            const size_t channel_at = cdr_channel_offset(i);
+            const size_t value_at = 8 + i * CDR_READING;
+            if (channel_at + 4 < value_at) le_store32(body + channel_at + 4, 0);   // padding
+            le_store32(body + channel_at, r.channel);
+            le_store64(body + value_at, bit_cast_value<uint64_t>(r.value));
+            le_store64(body + value_at + 8, static_cast<uint64_t>(r.timestamp));
+            le_store64(body + value_at + 16, static_cast<uint64_t>(r.sequence_num));
+        }
+    }
+
+    void write_fixed(uint8_t* out) const {
+        using namespace frame_wire;
+        le_store32(out, static_cast<uint32_t>(m_pending.size()));
+        uint8_t* p = out + FIXED_HEADER;
+        for (const frameReading& r : m_pending) {
+            le_store32(p, r.channel);
+            le_store64(p + 4, bit_cast_value<uint64_t>(r.value));
+            le_store64(p + 12, static_cast<uint64_t>(r.timestamp));
+            le_store64(p + 20, static_cast<uint64_t>(r.sequence_num));
+            p += FIXED_RECORD;
+        }
+    }
+
+    void write_schema(uint8_t* out) const {
+        using namespace frame_wire;
+        for (const frameReading& r : m_pending) {
+            out[0] = SCHEMA_READING_TAG;
+            out[1] = static_cast<uint8_t>(readingSchema::max_size);
+            readingSchema::encode(r, out + 2);
+            out += SCHEMA_ENTRY;
+        }
+    }
+
+public:
+    // compress only applies to Protobuf
+    explicit frameEncoder(frameCodec codec = frameCodec::Protobuf, bool compress = false)
+        : m_codec(codec), m_compress(compress && codec == frameCodec::Protobuf) {}
+
+    void add(uint32_t channel, double value, int64_t timestamp, int64_t sequence_num){
+        if (m_codec != frameCodec::Protobuf) {
+            m_pending.push_back(frameReading{channel, value, timestamp, sequence_num});
+        } else if (m_compress) {
+            m_gorilla.append(channel, timestamp, value, sequence_num);
+        } else {
+            m_frame.add_sensor_index(channel);
+            m_frame.add_value(value);
+            m_frame.add_timestamp(timestamp);
+            m_frame.add_sequence_num(sequence_num);
+        }
+        m_count++;
+    }
+
+    size_t count() const { return m_count; }
+    bool empty() const { return m_count == 0; }
+    frameCodec codec() const { return m_codec; }
+
+    // Bytes write_to() will produce for the readings added so far
+    size_t encoded_size(){
+        switch (m_codec) {
+            case frameCodec::Protobuf:
+                if (!m_gorilla.empty()) m_gorilla.finish(*m_frame.mutable_compressed());
+                return m_frame.ByteSizeLong();   // caches the sizes write_to() relies on
+            case frameCodec::Cdr:
+                return frame_wire::cdr_size(m_pending.size());
+            case frameCodec::Fixed:
+                return frame_wire::FIXED_HEADER + m_pending.size() * frame_wire::FIXED_RECORD;
+            case frameCodec::Schema:
+                return m_pending.size() * frame_wire::SCHEMA_ENTRY;
+        }
+        return 0;
+    }
+
+    // Writes exactly encoded_size() bytes, then clears the frame keeping its storage
+    void write_to(uint8_t* out){
+        switch (m_codec) {
+            case frameCodec::Protobuf:
+                m_frame.SerializeWithCachedSizesToArray(out);
+                m_frame.Clear();
+                break;
+            case frameCodec::Cdr:
+                write_cdr(out);
+                break;
+            case frameCodec::Fixed:
+                write_fixed(out);
+                break;
+            case frameCodec::Schema:
+                write_schema(out);
+                break;
+        }
+        m_pending.clear();
+        m_count = 0;
+    }
+
+    // Convenience for tests and benchmarks: replaces out with the encoded frame
+    template <typename Bytes>
+    void finish(Bytes& out){
+        out.resize(encoded_size());
+        write_to(reinterpret_cast<uint8_t*>(out.data()));
+    }
+};
@@ -0,0 +1,206 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "sensor.pb.h"
+#include "frame_codec.h"
+#include "utilities/gorilla_codec.h"
+
+// One decoded reading. The sensor id is interned: sensor indexes the decoder's
+// name table, so records are plain data and cost no heap allocation.
+struct sensorRecord {
+    uint32_t sensor;
+    double value;
+    int64_t timestamp;
+    int64_t sequence_num;
+};
+
+// Decodes telemetry frames straight from the received bytes. The frame message,
+// its string storage and the caller's record vector are all reused, so once the
+// sensor names and frame sizes have been seen decoding does not allocate.
+// Frames either list their sensor names or carry publisher channel ids, named
+// through define_channel() from the channel dictionary; the Cdr, Fixed and
+// Schema codecs always carry channel ids. One decoder per thread.
+class frameDecoder {
+private:
+    static constexpr uint32_t NO_SLOT = std::numeric_limits<uint32_t>::max();
+    // Guards the channel table against ids from corrupt frames
+    static constexpr uint32_t MAX_CHANNELS = 1u << 20;
+
+    frameCodec m_codec;
+    sensor_proto::proto_frame m_frame;
+    std::vector<std::string> m_names;
+    std::unordered_map<std::string, uint32_t> m_ids;
+    std::vector<uint32_t> m_remap;           // frame-local sensor index -> interned id
+    std::vector<uint32_t> m_channel_slots;   // publisher channel id -> interned id
+    bool m_by_channel = false;               // current frame carries channel ids
+
+    static std::string placeholder_name(uint32_t channel){
+        return "channel-" + std::to_string(channel);
+    }
+
+    uint32_t* channel_slot(uint32_t channel){
+        if (channel >= MAX_CHANNELS) return nullptr;
+        if (channel >= m_channel_slots.size()) m_channel_slots.resize(channel + 1, NO_SLOT);
+        return &m_channel_slots[channel];
+    }
+
+    // Interned id for a reading's sensor_index in the current frame
+    bool resolve(uint32_t local, uint32_t& id){
+        if (!m_by_channel) {
+            if (local >= m_remap.size()) return false;
+            id = m_remap[local];
+            return true;
+        }
+        uint32_t* slot = channel_slot(local);
+        if (slot == nullptr) return false;
+        // Data can beat the dictionary; the channel is named once it arrives
+        if (*slot == NO_SLOT) *slot = intern(placeholder_name(local));
+        id = *slot;
+        return true;
+    }
+
+    uint32_t intern(const std::string& name){
+        const auto found = m_ids.find(name);
+        if (found != m_ids.end()) return found->second;
+        const uint32_t id = static_cast<uint32_t>(m_names.size());
+        m_names.push_back(name);
+        m_ids.emplace(name, id);
+        return id;
+    }
+
+    bool decode_cdr(const uint8_t* data, size_t size, std::vector<sensorRecord>& out){
+        using namespace frame_wire;
+        if (size < CDR_HEADER + 4 || data[1] != CDR_LE_ENCAPSULATION[1]) return false;
+        const uint8_t* body = data + CDR_HEADER;
+        const uint32_t count = le_load32(body);
+        if (size != cdr_size(count)) return false;
+        out.resize(count);
+        for (size_t i = 0; i < count; ++i) {
+            const size_t value_at = 8 + i * CDR_READING;
+            uint32_t id;
+            if (!resolve(le_load32(body + cdr_channel_offset(i)), id)) return false;
+            out[i] = sensorRecord{id, bit_cast_value<double>(le_load64(body + value_at)),
+                                  static_cast<int64_t>(le_load64(body + value_at + 8)),
+                                  static_cast<int64_t>(le_load64(body + value_at + 16))};
+        }
+        return true;
+    }
+
+    bool decode_fixed(const uint8_t* data, size_t size, std::vector<sensorRecord>& out){
+        using namespace frame_wire;
+        if (size < FIXED_HEADER) return false;
+        const uint32_t count = le_load32(data);
+        if ((size - FIXED_HEADER) / FIXED_RECORD != count || (size - FIXED_HEADER) % FIXED_RECORD != 0) return false;
+        out.resize(count);
+        const uint8_t* p = data + FIXED_HEADER;
+        for (size_t i = 0; i < count; ++i, p += FIXED_RECORD) {
+            uint32_t id;
+            if (!resolve(le_load32(p), id)) return false;
+            out[i] = sensorRecord{id, bit_cast_value<double>(le_load64(p + 4)),
+                                  static_cast<int64_t>(le_load64(p + 12)),
+                                  static_cast<int64_t>(le_load64(p + 20))};
+        }
+        return true;
+    }
+
+    bool decode_schema(const uint8_t* data, size_t size, std::vector<sensorRecord>& out){
+        const uint8_t* p = data;
+        const uint8_t* end = data + size;
+        frameReading reading;
+        while (p < end) {
+            // Entries of other proto_frame fields are not part of this codec
+            uint64_t len;
+            if (*p++ != frame_wire::SCHEMA_READING_TAG || !schema_detail::read_varint(p, end, len)) return false;
+            if (len > static_cast<uint64_t>(end - p) || !readingSchema::decode(p, len, reading)) return false;
+            p += len;
+            uint32_t id;
+            if (!resolve(reading.channel, id)) return false;
+            out.push_back(sensorRecord{id, reading.value, reading.timestamp, reading.sequence_num});
+        }
+        return true;
+    }
+
+public:
+    explicit frameDecoder(frameCodec codec = frameCodec::Protobuf) : m_codec(codec) {}
+
+    // Replaces out with the frame's readings. Returns false, with out empty, when
+    // the bytes are not a well-formed frame.
+    bool decode(const uint8_t* data, size_t size, std::vector<sensorRecord>& out){
+        out.clear();
+        if (m_codec != frameCodec::Protobuf) {
+            m_by_channel = true;
+            bool ok = false;
+            switch (m_codec) {
+                case frameCodec::Cdr: ok = decode_cdr(data, size, out); break;
+                case frameCodec::Fixed: ok = decode_fixed(data, size, out); break;
+                case frameCodec::Schema: ok = decode_schema(data, size, out); break;
+                case frameCodec::Protobuf: break;
+            }
+            if (!ok) out.clear();
+            return ok;
+        }
+        if (!m_frame.ParseFromArray(data, static_cast<int>(size))) return false;
+
+        const int count = m_frame.sensor_index_size();
+        if (m_frame.value_size() != count || m_frame.timestamp_size() != count || m_frame.sequence_num_size() != count) {
+            return false;
+        }
+        m_remap.clear();
+        for (const std::string& name : m_frame.sensors()) m_remap.push_back(intern(name));
+        m_by_channel = m_remap.empty();
+
+        if (!m_frame.compressed().empty()) {
+            if (count != 0) return false;
+            const std::string& block = m_frame.compressed();
+            bool bad_index = false;
+            const bool parsed = gorilla_decode_block(reinterpret_cast<const uint8_t*>(block.data()), block.size(),
+                [&](uint32_t local, int64_t ts, double value, int64_t seq){
+                    uint32_t id;
+                    if (!resolve(local, id)) {
+                        bad_index = true;
+                        return;
+                    }
+                    out.push_back(sensorRecord{id, value, ts, seq});
+                });
+            if (!parsed || bad_index) {
+                out.clear();
+                return false;
+            }
+            return true;
+        }
+
+        out.resize(static_cast<size_t>(count));
+        for (int i = 0; i < count; ++i) {
+            uint32_t id;
+            if (!resolve(m_frame.sensor_index(i), id)) {
+                out.clear();
+                return false;
+            }
+            out[i] = sensorRecord{id, m_frame.value(i), m_frame.timestamp(i), m_frame.sequence_num(i)};
+        }
+        return true;
+    }
+
+    // Names a publisher channel id (one channel dictionary entry). A channel seen
+    // before its name keeps its record id and just loses the placeholder name.
+    bool define_channel(uint32_t channel, const std::string& name){
+        uint32_t* slot = channel_slot(channel);
+        if (slot == nullptr) return false;
+        if (*slot != NO_SLOT && m_names[*slot] == placeholder_name(channel) && m_ids.count(name) == 0) {
+            m_ids.erase(m_names[*slot]);
+            m_names[*slot] = name;
+            m_ids.emplace(name, *slot);
+        } else {
+            *slot = intern(name);
+        }
+        return true;
+    }
+
+    const std::string& name(uint32_t sensor) const { return m_names[sensor]; }
+    size_t sensor_count() const { return m_names.size(); }
+};
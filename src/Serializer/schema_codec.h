@@ -0,0 +1,179 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include "utilities/little_endian.h"
+
+// Protobuf wire encoding of records whose schema is known at compile time. A
+// schema lists (field number, member, wire type); tags, sizes and offsets are
+// constants, so encoding a fixed-width schema is a run of stores and decoding
+// what it wrote a run of tag compares and loads. Output is plain protobuf: the
+// generated code parses it, and decode() also accepts anything the generated
+// code writes for the same message (omitted zero fields, other field order,
+// unknown fields).
+
+// The protobuf wire types a scalar schema field can use
+enum class wireType : uint8_t {
+    Varint = 0,    // int32, int64, uint32, uint64, bool
+    Fixed64 = 1,   // double, fixed64, sfixed64
+    Fixed32 = 5    // float, fixed32, sfixed32
+};
+
+namespace schema_detail {
+
+template <typename M> struct member_traits;
+template <typename R, typename T> struct member_traits<T R::*> {
+    using record = R;
+    using type = T;
+};
+
+inline bool read_varint(const uint8_t*& p, const uint8_t* end, uint64_t& v){
+    v = 0;
+    for (int shift = 0; shift < 64 && p < end; shift += 7) {
+        const uint8_t byte = *p++;
+        v |= uint64_t(byte & 0x7f) << shift;
+        if (!(byte & 0x80)) return true;
+    }
+    return false;
+}
+
+// Skips a field this schema does not know
+inline bool skip_field(const uint8_t*& p, const uint8_t* end, uint32_t wire){
+    uint64_t len;
+    switch (wire) {
+        case 0: return read_varint(p, end, len);
+        case 1: len = 8; break;
+        case 2: if (!read_varint(p, end, len)) return false; break;
+        case 5: len = 4; break;
+        default: return false;
+    }
+    if (len > static_cast<uint64_t>(end - p)) return false;
+    p += len;
+    return true;
+}
+
+}  // namespace schema_detail
+
+template <uint32_t Number, auto Member, wireType Wire>
+struct schemaField {
+    using record_type = typename schema_detail::member_traits<decltype(Member)>::record;
+    using value_type = typename schema_detail::member_traits<decltype(Member)>::type;
+
+    static_assert(Number >= 1 && Number <= 15, "field numbers above 15 need multi-byte tags");
+    static_assert(std::is_arithmetic_v<value_type>, "scalar fields only");
+    static_assert(Wire != wireType::Fixed32 || sizeof(value_type) == 4, "Fixed32 needs a 4-byte member");
+    static_assert(Wire != wireType::Fixed64 || sizeof(value_type) == 8, "Fixed64 needs an 8-byte member");
+    static_assert(Wire != wireType::Varint || std::is_integral_v<value_type>, "Varint needs an integer member");
+
+    static constexpr uint32_t number = Number;
+    static constexpr wireType wire = Wire;
+    static constexpr uint8_t tag = static_cast<uint8_t>((Number << 3) | static_cast<uint32_t>(Wire));
+    static constexpr size_t max_size = 1 + (Wire == wireType::Fixed32 ? 4 : Wire == wireType::Fixed64 ? 8 : 10);
+
+    static uint8_t* encode(const record_type& r, uint8_t* p){
+        *p++ = tag;
+        const value_type v = r.*Member;
+        if constexpr (Wire == wireType::Fixed32) {
+            le_store32(p, bit_cast_value<uint32_t>(v));
+            return p + 4;
+        } else if constexpr (Wire == wireType::Fixed64) {
+            le_store64(p, bit_cast_value<uint64_t>(v));
+            return p + 8;
+        } else {
+            // Negative int32 values are sign-extended to ten bytes, as protobuf does
+            uint64_t u = static_cast<uint64_t>(v);
+            while (u >= 0x80) {
+                *p++ = static_cast<uint8_t>(u | 0x80);
+                u >>= 7;
+            }
+            *p++ = static_cast<uint8_t>(u);
+            return p;
+        }
+    }
+
+    // Value at p, which is past the tag and has room for it; Fixed only
+    static const uint8_t* load(const uint8_t* p, record_type& r){
+        if constexpr (Wire == wireType::Fixed32) {
+            r.*Member = bit_cast_value<value_type>(le_load32(p));
+            return p + 4;
+        } else {
+            static_assert(Wire == wireType::Fixed64, "load() is for fixed-width fields");
+            r.*Member = bit_cast_value<value_type>(le_load64(p));
+            return p + 8;
+        }
+    }
+
+    // Bounds-checked read of a value of this field's wire type
+    static bool read(const uint8_t*& p, const uint8_t* end, record_type& r){
+        const size_t avail = static_cast<size_t>(end - p);
+        if constexpr (Wire == wireType::Varint) {
+            uint64_t u;
+            if (!schema_detail::read_varint(p, end, u)) return false;
+            r.*Member = static_cast<value_type>(u);
+            return true;
+        } else {
+            if (avail < max_size - 1) return false;
+            p = load(p, r);
+            return true;
+        }
+    }
+};
+
+template <typename First, typename... Rest>
+struct recordSchema {
+    using record_type = typename First::record_type;
+    static_assert((std::is_same_v<record_type, typename Rest::record_type> && ...), "fields of one record");
+
+    // Upper bound of encode(); the exact size when fixed_size
+    static constexpr size_t max_size = (First::max_size + ... + Rest::max_size);
+    static constexpr bool fixed_size = First::wire != wireType::Varint && ((Rest::wire != wireType::Varint) && ...);
+
+    // Writes every field, zeros included, in schema order. Returns bytes written.
+    static size_t encode(const record_type& r, uint8_t* out){
+        uint8_t* p = First::encode(r, out);
+        ((p = Rest::encode(r, p)), ...);
+        return static_cast<size_t>(p - out);
+    }
+
+    // Returns false on malformed input; fields missing from the input keep their zero default
+    static bool decode(const uint8_t* data, size_t size, record_type& r){
+        if constexpr (fixed_size) {
+            // Exactly what encode() writes: constant offsets, one compare per tag
+            const uint8_t* p = data;
+            if (size == max_size && load_in_order<First, Rest...>(p, r)) return true;
+        }
+        return decode_tagged(data, size, r);
+    }
+
+private:
+    template <typename F, typename... Fs>
+    static bool load_in_order(const uint8_t*& p, record_type& r){
+        if (*p != F::tag) return false;
+        p = F::load(p + 1, r);
+        if constexpr (sizeof...(Fs) > 0) return load_in_order<Fs...>(p, r);
+        else return true;
+    }
+
+    static bool decode_tagged(const uint8_t* data, size_t size, record_type& r){
+        r = record_type{};
+        const uint8_t* p = data;
+        const uint8_t* end = data + size;
+        while (p < end) {
+            uint64_t key;
+            if (!schema_detail::read_varint(p, end, key)) return false;
+            bool ok = true;
+            const bool known = (read_if<First>(key, p, end, r, ok) || ... || read_if<Rest>(key, p, end, r, ok));
+            if (!ok) return false;
+            if (!known && !schema_detail::skip_field(p, end, static_cast<uint32_t>(key & 7))) return false;
+        }
+        return true;
+    }
+
+    template <typename F>
+    static bool read_if(uint64_t key, const uint8_t*& p, const uint8_t* end, record_type& r, bool& ok){
+        if (key != F::tag) return false;
+        ok = F::read(p, end, r);
+        return true;
+    }
+};
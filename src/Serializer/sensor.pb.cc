@@ -16,26 +16,69 @@
 #include <google/protobuf/port_def.inc>
 
 PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
 namespace sensor_proto {
-constexpr proto_serial_data::proto_serial_data(
-  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
-  : sensor_id_(&::PROTOBUF_NAMESPACE_ID::internal::fixed_address_empty_string)
-  , value_(0)
-  , timestamp_(int64_t{0})
-  , sequence_num_(int64_t{0}){}
+PROTOBUF_CONSTEXPR proto_serial_data::proto_serial_data(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.sensor_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/0
+  , /*decltype(_impl_.timestamp_)*/int64_t{0}
+  , /*decltype(_impl_.sequence_num_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct proto_serial_dataDefaultTypeInternal {
-  constexpr proto_serial_dataDefaultTypeInternal()
-    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  PROTOBUF_CONSTEXPR proto_serial_dataDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
   ~proto_serial_dataDefaultTypeInternal() {}
   union {
     proto_serial_data _instance;
   };
 };
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT proto_serial_dataDefaultTypeInternal _proto_serial_data_default_instance_;
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 proto_serial_dataDefaultTypeInternal _proto_serial_data_default_instance_;
+PROTOBUF_CONSTEXPR proto_frame::proto_frame(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.sensors_)*/{}
+  , /*decltype(_impl_.sensor_index_)*/{}
+  , /*decltype(_impl_._sensor_index_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.value_)*/{}
+  , /*decltype(_impl_.timestamp_)*/{}
+  , /*decltype(_impl_._timestamp_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.sequence_num_)*/{}
+  , /*decltype(_impl_._sequence_num_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.readings_)*/{}
+  , /*decltype(_impl_.compressed_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct proto_frameDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR proto_frameDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~proto_frameDefaultTypeInternal() {}
+  union {
+    proto_frame _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 proto_frameDefaultTypeInternal _proto_frame_default_instance_;
+PROTOBUF_CONSTEXPR proto_reading::proto_reading(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.value_)*/0
+  , /*decltype(_impl_.timestamp_)*/int64_t{0}
+  , /*decltype(_impl_.sequence_num_)*/int64_t{0}
+  , /*decltype(_impl_.channel_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct proto_readingDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR proto_readingDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~proto_readingDefaultTypeInternal() {}
+  union {
+    proto_reading _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 proto_readingDefaultTypeInternal _proto_reading_default_instance_;
 }  // namespace sensor_proto
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_sensor_2eproto[1];
-static constexpr ::PROTOBUF_NAMESPACE_ID::EnumDescriptor const** file_level_enum_descriptors_sensor_2eproto = nullptr;
-static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_sensor_2eproto = nullptr;
+static ::_pb::Metadata file_level_metadata_sensor_2eproto[3];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_sensor_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_sensor_2eproto = nullptr;
 
 const uint32_t TableStruct_sensor_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   ~0u,  // no _has_bits_
@@ -44,38 +87,73 @@ const uint32_t TableStruct_sensor_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(p
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::sensor_proto::proto_serial_data, sensor_id_),
-  PROTOBUF_FIELD_OFFSET(::sensor_proto::proto_serial_data, value_),
-  PROTOBUF_FIELD_OFFSET(::sensor_proto::proto_serial_data, timestamp_),
-  PROTOBUF_FIELD_OFFSET(::sensor_proto::proto_serial_data, sequence_num_),
+  PROTOBUF_FIELD_OFFSET(::sensor_proto::proto_serial_data, _impl_.sensor_id_),
+  PROTOBUF_FIELD_OFFSET(::sensor_proto::proto_serial_data, _impl_.value_),
+  PROTOBUF_FIELD_OFFSET(::sensor_proto::proto_serial_data, _impl_.timestamp_),
+  PROTOBUF_FIELD_OFFSET(::sensor_proto::proto_serial_data, _impl_.sequence_num_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::sensor_proto::proto_frame, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::sensor_proto::proto_frame, _impl_.sensors_),
+  PROTOBUF_FIELD_OFFSET(::sensor_proto::proto_frame, _impl_.sensor_index_),
+  PROTOBUF_FIELD_OFFSET(::sensor_proto::proto_frame, _impl_.value_),
+  PROTOBUF_FIELD_OFFSET(::sensor_proto::proto_frame, _impl_.timestamp_),
+  PROTOBUF_FIELD_OFFSET(::sensor_proto::proto_frame, _impl_.sequence_num_),
+  PROTOBUF_FIELD_OFFSET(::sensor_proto::proto_frame, _impl_.compressed_),
+  PROTOBUF_FIELD_OFFSET(::sensor_proto::proto_frame, _impl_.readings_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::sensor_proto::proto_reading, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::sensor_proto::proto_reading, _impl_.channel_),
+  PROTOBUF_FIELD_OFFSET(::sensor_proto::proto_reading, _impl_.value_),
+  PROTOBUF_FIELD_OFFSET(::sensor_proto::proto_reading, _impl_.timestamp_),
+  PROTOBUF_FIELD_OFFSET(::sensor_proto::proto_reading, _impl_.sequence_num_),
 };
-static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, -1, -1, sizeof(::sensor_proto::proto_serial_data)},
+  { 10, -1, -1, sizeof(::sensor_proto::proto_frame)},
+  { 23, -1, -1, sizeof(::sensor_proto::proto_reading)},
 };
 
-static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::sensor_proto::_proto_serial_data_default_instance_),
+static const ::_pb::Message* const file_default_instances[] = {
+  &::sensor_proto::_proto_serial_data_default_instance_._instance,
+  &::sensor_proto::_proto_frame_default_instance_._instance,
+  &::sensor_proto::_proto_reading_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_sensor_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
   "\n\014sensor.proto\022\014sensor_proto\"^\n\021proto_se"
   "rial_data\022\021\n\tsensor_id\030\001 \001(\t\022\r\n\005value\030\002 "
   "\001(\001\022\021\n\ttimeStamp\030\003 \001(\003\022\024\n\014sequence_num\030\004"
-  " \001(\003b\006proto3"
+  " \001(\003\"\257\001\n\013proto_frame\022\017\n\007sensors\030\001 \003(\t\022\024\n"
+  "\014sensor_index\030\002 \003(\r\022\r\n\005value\030\003 \003(\001\022\021\n\tti"
+  "meStamp\030\004 \003(\003\022\024\n\014sequence_num\030\005 \003(\003\022\022\n\nc"
+  "ompressed\030\006 \001(\014\022-\n\010readings\030\007 \003(\0132\033.sens"
+  "or_proto.proto_reading\"X\n\rproto_reading\022"
+  "\017\n\007channel\030\001 \001(\007\022\r\n\005value\030\002 \001(\001\022\021\n\ttimeS"
+  "tamp\030\003 \001(\020\022\024\n\014sequence_num\030\004 \001(\020b\006proto3"
   ;
-static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_sensor_2eproto_once;
-const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_sensor_2eproto = {
-  false, false, 132, descriptor_table_protodef_sensor_2eproto, "sensor.proto", 
-  &descriptor_table_sensor_2eproto_once, nullptr, 0, 1,
-  schemas, file_default_instances, TableStruct_sensor_2eproto::offsets,
-  file_level_metadata_sensor_2eproto, file_level_enum_descriptors_sensor_2eproto, file_level_service_descriptors_sensor_2eproto,
+static ::_pbi::once_flag descriptor_table_sensor_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_sensor_2eproto = {
+    false, false, 400, descriptor_table_protodef_sensor_2eproto,
+    "sensor.proto",
+    &descriptor_table_sensor_2eproto_once, nullptr, 0, 3,
+    schemas, file_default_instances, TableStruct_sensor_2eproto::offsets,
+    file_level_metadata_sensor_2eproto, file_level_enum_descriptors_sensor_2eproto,
+    file_level_service_descriptors_sensor_2eproto,
 };
-PROTOBUF_ATTRIBUTE_WEAK const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable* descriptor_table_sensor_2eproto_getter() {
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_sensor_2eproto_getter() {
   return &descriptor_table_sensor_2eproto;
 }
 
 // Force running AddDescriptors() at dynamic initialization time.
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY static ::PROTOBUF_NAMESPACE_ID::internal::AddDescriptorsRunner dynamic_init_dummy_sensor_2eproto(&descriptor_table_sensor_2eproto);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_sensor_2eproto(&descriptor_table_sensor_2eproto);
 namespace sensor_proto {
 
 // ===================================================================
@@ -87,60 +165,67 @@ class proto_serial_data::_Internal {
 proto_serial_data::proto_serial_data(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor();
-  if (!is_message_owned) {
-    RegisterArenaDtor(arena);
-  }
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:sensor_proto.proto_serial_data)
 }
 proto_serial_data::proto_serial_data(const proto_serial_data& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  proto_serial_data* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.sensor_id_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.timestamp_){}
+    , decltype(_impl_.sequence_num_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  sensor_id_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.sensor_id_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    sensor_id_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+    _impl_.sensor_id_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_sensor_id().empty()) {
-    sensor_id_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_sensor_id(), 
-      GetArenaForAllocation());
+    _this->_impl_.sensor_id_.Set(from._internal_sensor_id(), 
+      _this->GetArenaForAllocation());
   }
-  ::memcpy(&value_, &from.value_,
-    static_cast<size_t>(reinterpret_cast<char*>(&sequence_num_) -
-    reinterpret_cast<char*>(&value_)) + sizeof(sequence_num_));
+  ::memcpy(&_impl_.value_, &from._impl_.value_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.sequence_num_) -
+    reinterpret_cast<char*>(&_impl_.value_)) + sizeof(_impl_.sequence_num_));
   // @@protoc_insertion_point(copy_constructor:sensor_proto.proto_serial_data)
 }
 
-inline void proto_serial_data::SharedCtor() {
-sensor_id_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  sensor_id_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-    reinterpret_cast<char*>(&value_) - reinterpret_cast<char*>(this)),
-    0, static_cast<size_t>(reinterpret_cast<char*>(&sequence_num_) -
-    reinterpret_cast<char*>(&value_)) + sizeof(sequence_num_));
+inline void proto_serial_data::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.sensor_id_){}
+    , decltype(_impl_.value_){0}
+    , decltype(_impl_.timestamp_){int64_t{0}}
+    , decltype(_impl_.sequence_num_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.sensor_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.sensor_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 proto_serial_data::~proto_serial_data() {
   // @@protoc_insertion_point(destructor:sensor_proto.proto_serial_data)
-  if (GetArenaForAllocation() != nullptr) return;
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
 inline void proto_serial_data::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  sensor_id_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.sensor_id_.Destroy();
 }
 
-void proto_serial_data::ArenaDtor(void* object) {
-  proto_serial_data* _this = reinterpret_cast< proto_serial_data* >(object);
-  (void)_this;
-}
-void proto_serial_data::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void proto_serial_data::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void proto_serial_data::Clear() {
@@ -149,33 +234,33 @@ void proto_serial_data::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  sensor_id_.ClearToEmpty();
-  ::memset(&value_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&sequence_num_) -
-      reinterpret_cast<char*>(&value_)) + sizeof(sequence_num_));
+  _impl_.sensor_id_.ClearToEmpty();
+  ::memset(&_impl_.value_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.sequence_num_) -
+      reinterpret_cast<char*>(&_impl_.value_)) + sizeof(_impl_.sequence_num_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* proto_serial_data::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* proto_serial_data::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // string sensor_id = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_sensor_id();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "sensor_proto.proto_serial_data.sensor_id"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "sensor_proto.proto_serial_data.sensor_id"));
         } else
           goto handle_unusual;
         continue;
       // double value = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
-          value_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          _impl_.value_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
         } else
           goto handle_unusual;
@@ -183,7 +268,7 @@ const char* proto_serial_data::_InternalParse(const char* ptr, ::PROTOBUF_NAMESP
       // int64 timeStamp = 3;
       case 3:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
-          timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          _impl_.timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -191,7 +276,7 @@ const char* proto_serial_data::_InternalParse(const char* ptr, ::PROTOBUF_NAMESP
       // int64 sequence_num = 4;
       case 4:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
-          sequence_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          _impl_.sequence_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -242,23 +327,23 @@ uint8_t* proto_serial_data::_InternalSerialize(
   memcpy(&raw_value, &tmp_value, sizeof(tmp_value));
   if (raw_value != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(2, this->_internal_value(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_value(), target);
   }
 
   // int64 timeStamp = 3;
   if (this->_internal_timestamp() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64ToArray(3, this->_internal_timestamp(), target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(3, this->_internal_timestamp(), target);
   }
 
   // int64 sequence_num = 4;
   if (this->_internal_sequence_num() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64ToArray(4, this->_internal_sequence_num(), target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(4, this->_internal_sequence_num(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:sensor_proto.proto_serial_data)
@@ -291,53 +376,49 @@ size_t proto_serial_data::ByteSizeLong() const {
 
   // int64 timeStamp = 3;
   if (this->_internal_timestamp() != 0) {
-    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int64SizePlusOne(this->_internal_timestamp());
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_timestamp());
   }
 
   // int64 sequence_num = 4;
   if (this->_internal_sequence_num() != 0) {
-    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int64SizePlusOne(this->_internal_sequence_num());
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_sequence_num());
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData proto_serial_data::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
     proto_serial_data::MergeImpl
 };
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*proto_serial_data::GetClassData() const { return &_class_data_; }
 
-void proto_serial_data::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<proto_serial_data *>(to)->MergeFrom(
-      static_cast<const proto_serial_data &>(from));
-}
-
 
-void proto_serial_data::MergeFrom(const proto_serial_data& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:sensor_proto.proto_serial_data)
-  GOOGLE_DCHECK_NE(&from, this);
+void proto_serial_data::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<proto_serial_data*>(&to_msg);
+  auto& from = static_cast<const proto_serial_data&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:sensor_proto.proto_serial_data)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   if (!from._internal_sensor_id().empty()) {
-    _internal_set_sensor_id(from._internal_sensor_id());
+    _this->_internal_set_sensor_id(from._internal_sensor_id());
   }
   static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
   double tmp_value = from._internal_value();
   uint64_t raw_value;
   memcpy(&raw_value, &tmp_value, sizeof(tmp_value));
   if (raw_value != 0) {
-    _internal_set_value(from._internal_value());
+    _this->_internal_set_value(from._internal_value());
   }
   if (from._internal_timestamp() != 0) {
-    _internal_set_timestamp(from._internal_timestamp());
+    _this->_internal_set_timestamp(from._internal_timestamp());
   }
   if (from._internal_sequence_num() != 0) {
-    _internal_set_sequence_num(from._internal_sequence_num());
+    _this->_internal_set_sequence_num(from._internal_sequence_num());
   }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void proto_serial_data::CopyFrom(const proto_serial_data& from) {
@@ -357,30 +438,739 @@ void proto_serial_data::InternalSwap(proto_serial_data* other) {
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      &sensor_id_, lhs_arena,
-      &other->sensor_id_, rhs_arena
+      &_impl_.sensor_id_, lhs_arena,
+      &other->_impl_.sensor_id_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(proto_serial_data, sequence_num_)
-      + sizeof(proto_serial_data::sequence_num_)
-      - PROTOBUF_FIELD_OFFSET(proto_serial_data, value_)>(
-          reinterpret_cast<char*>(&value_),
-          reinterpret_cast<char*>(&other->value_));
+      PROTOBUF_FIELD_OFFSET(proto_serial_data, _impl_.sequence_num_)
+      + sizeof(proto_serial_data::_impl_.sequence_num_)
+      - PROTOBUF_FIELD_OFFSET(proto_serial_data, _impl_.value_)>(
+          reinterpret_cast<char*>(&_impl_.value_),
+          reinterpret_cast<char*>(&other->_impl_.value_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata proto_serial_data::GetMetadata() const {
-  return ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(
+  return ::_pbi::AssignDescriptors(
       &descriptor_table_sensor_2eproto_getter, &descriptor_table_sensor_2eproto_once,
       file_level_metadata_sensor_2eproto[0]);
 }
 
+// ===================================================================
+
+class proto_frame::_Internal {
+ public:
+};
+
+proto_frame::proto_frame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:sensor_proto.proto_frame)
+}
+proto_frame::proto_frame(const proto_frame& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  proto_frame* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.sensors_){from._impl_.sensors_}
+    , decltype(_impl_.sensor_index_){from._impl_.sensor_index_}
+    , /*decltype(_impl_._sensor_index_cached_byte_size_)*/{0}
+    , decltype(_impl_.value_){from._impl_.value_}
+    , decltype(_impl_.timestamp_){from._impl_.timestamp_}
+    , /*decltype(_impl_._timestamp_cached_byte_size_)*/{0}
+    , decltype(_impl_.sequence_num_){from._impl_.sequence_num_}
+    , /*decltype(_impl_._sequence_num_cached_byte_size_)*/{0}
+    , decltype(_impl_.readings_){from._impl_.readings_}
+    , decltype(_impl_.compressed_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.compressed_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.compressed_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_compressed().empty()) {
+    _this->_impl_.compressed_.Set(from._internal_compressed(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:sensor_proto.proto_frame)
+}
+
+inline void proto_frame::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.sensors_){arena}
+    , decltype(_impl_.sensor_index_){arena}
+    , /*decltype(_impl_._sensor_index_cached_byte_size_)*/{0}
+    , decltype(_impl_.value_){arena}
+    , decltype(_impl_.timestamp_){arena}
+    , /*decltype(_impl_._timestamp_cached_byte_size_)*/{0}
+    , decltype(_impl_.sequence_num_){arena}
+    , /*decltype(_impl_._sequence_num_cached_byte_size_)*/{0}
+    , decltype(_impl_.readings_){arena}
+    , decltype(_impl_.compressed_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.compressed_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.compressed_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+proto_frame::~proto_frame() {
+  // @@protoc_insertion_point(destructor:sensor_proto.proto_frame)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void proto_frame::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.sensors_.~RepeatedPtrField();
+  _impl_.sensor_index_.~RepeatedField();
+  _impl_.value_.~RepeatedField();
+  _impl_.timestamp_.~RepeatedField();
+  _impl_.sequence_num_.~RepeatedField();
+  _impl_.readings_.~RepeatedPtrField();
+  _impl_.compressed_.Destroy();
+}
+
+void proto_frame::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void proto_frame::Clear() {
+// @@protoc_insertion_point(message_clear_start:sensor_proto.proto_frame)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.sensors_.Clear();
+  _impl_.sensor_index_.Clear();
+  _impl_.value_.Clear();
+  _impl_.timestamp_.Clear();
+  _impl_.sequence_num_.Clear();
+  _impl_.readings_.Clear();
+  _impl_.compressed_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* proto_frame::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated string sensors = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_sensors();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "sensor_proto.proto_frame.sensors"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 sensor_index = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_sensor_index(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 16) {
+          _internal_add_sensor_index(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated double value = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedDoubleParser(_internal_mutable_value(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 25) {
+          _internal_add_value(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr));
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int64 timeStamp = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt64Parser(_internal_mutable_timestamp(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 32) {
+          _internal_add_timestamp(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int64 sequence_num = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt64Parser(_internal_mutable_sequence_num(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 40) {
+          _internal_add_sequence_num(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes compressed = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_compressed();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .sensor_proto.proto_reading readings = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_readings(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<58>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* proto_frame::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:sensor_proto.proto_frame)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated string sensors = 1;
+  for (int i = 0, n = this->_internal_sensors_size(); i < n; i++) {
+    const auto& s = this->_internal_sensors(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "sensor_proto.proto_frame.sensors");
+    target = stream->WriteString(1, s, target);
+  }
+
+  // repeated uint32 sensor_index = 2;
+  {
+    int byte_size = _impl_._sensor_index_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          2, _internal_sensor_index(), byte_size, target);
+    }
+  }
+
+  // repeated double value = 3;
+  if (this->_internal_value_size() > 0) {
+    target = stream->WriteFixedPacked(3, _internal_value(), target);
+  }
+
+  // repeated int64 timeStamp = 4;
+  {
+    int byte_size = _impl_._timestamp_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt64Packed(
+          4, _internal_timestamp(), byte_size, target);
+    }
+  }
+
+  // repeated int64 sequence_num = 5;
+  {
+    int byte_size = _impl_._sequence_num_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt64Packed(
+          5, _internal_sequence_num(), byte_size, target);
+    }
+  }
+
+  // bytes compressed = 6;
+  if (!this->_internal_compressed().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        6, this->_internal_compressed(), target);
+  }
+
+  // repeated .sensor_proto.proto_reading readings = 7;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_readings_size()); i < n; i++) {
+    const auto& repfield = this->_internal_readings(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(7, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:sensor_proto.proto_frame)
+  return target;
+}
+
+size_t proto_frame::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:sensor_proto.proto_frame)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string sensors = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.sensors_.size());
+  for (int i = 0, n = _impl_.sensors_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.sensors_.Get(i));
+  }
+
+  // repeated uint32 sensor_index = 2;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.sensor_index_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._sensor_index_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated double value = 3;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_value_size());
+    size_t data_size = 8UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // repeated int64 timeStamp = 4;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int64Size(this->_impl_.timestamp_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._timestamp_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated int64 sequence_num = 5;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int64Size(this->_impl_.sequence_num_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._sequence_num_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated .sensor_proto.proto_reading readings = 7;
+  total_size += 1UL * this->_internal_readings_size();
+  for (const auto& msg : this->_impl_.readings_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // bytes compressed = 6;
+  if (!this->_internal_compressed().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_compressed());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData proto_frame::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    proto_frame::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*proto_frame::GetClassData() const { return &_class_data_; }
+
+
+void proto_frame::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<proto_frame*>(&to_msg);
+  auto& from = static_cast<const proto_frame&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:sensor_proto.proto_frame)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.sensors_.MergeFrom(from._impl_.sensors_);
+  _this->_impl_.sensor_index_.MergeFrom(from._impl_.sensor_index_);
+  _this->_impl_.value_.MergeFrom(from._impl_.value_);
+  _this->_impl_.timestamp_.MergeFrom(from._impl_.timestamp_);
+  _this->_impl_.sequence_num_.MergeFrom(from._impl_.sequence_num_);
+  _this->_impl_.readings_.MergeFrom(from._impl_.readings_);
+  if (!from._internal_compressed().empty()) {
+    _this->_internal_set_compressed(from._internal_compressed());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void proto_frame::CopyFrom(const proto_frame& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:sensor_proto.proto_frame)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool proto_frame::IsInitialized() const {
+  return true;
+}
+
+void proto_frame::InternalSwap(proto_frame* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.sensors_.InternalSwap(&other->_impl_.sensors_);
+  _impl_.sensor_index_.InternalSwap(&other->_impl_.sensor_index_);
+  _impl_.value_.InternalSwap(&other->_impl_.value_);
+  _impl_.timestamp_.InternalSwap(&other->_impl_.timestamp_);
+  _impl_.sequence_num_.InternalSwap(&other->_impl_.sequence_num_);
+  _impl_.readings_.InternalSwap(&other->_impl_.readings_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.compressed_, lhs_arena,
+      &other->_impl_.compressed_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata proto_frame::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_sensor_2eproto_getter, &descriptor_table_sensor_2eproto_once,
+      file_level_metadata_sensor_2eproto[1]);
+}
+
+// ===================================================================
+
+class proto_reading::_Internal {
+ public:
+};
+
+proto_reading::proto_reading(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:sensor_proto.proto_reading)
+}
+proto_reading::proto_reading(const proto_reading& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  proto_reading* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.value_){}
+    , decltype(_impl_.timestamp_){}
+    , decltype(_impl_.sequence_num_){}
+    , decltype(_impl_.channel_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.value_, &from._impl_.value_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.channel_) -
+    reinterpret_cast<char*>(&_impl_.value_)) + sizeof(_impl_.channel_));
+  // @@protoc_insertion_point(copy_constructor:sensor_proto.proto_reading)
+}
+
+inline void proto_reading::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.value_){0}
+    , decltype(_impl_.timestamp_){int64_t{0}}
+    , decltype(_impl_.sequence_num_){int64_t{0}}
+    , decltype(_impl_.channel_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+proto_reading::~proto_reading() {
+  // @@protoc_insertion_point(destructor:sensor_proto.proto_reading)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void proto_reading::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void proto_reading::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void proto_reading::Clear() {
+// @@protoc_insertion_point(message_clear_start:sensor_proto.proto_reading)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.value_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.channel_) -
+      reinterpret_cast<char*>(&_impl_.value_)) + sizeof(_impl_.channel_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* proto_reading::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // fixed32 channel = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _impl_.channel_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // double value = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _impl_.value_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // sfixed64 timeStamp = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _impl_.timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<int64_t>(ptr);
+          ptr += sizeof(int64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // sfixed64 sequence_num = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _impl_.sequence_num_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<int64_t>(ptr);
+          ptr += sizeof(int64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* proto_reading::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:sensor_proto.proto_reading)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // fixed32 channel = 1;
+  if (this->_internal_channel() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(1, this->_internal_channel(), target);
+  }
+
+  // double value = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_value = this->_internal_value();
+  uint64_t raw_value;
+  memcpy(&raw_value, &tmp_value, sizeof(tmp_value));
+  if (raw_value != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_value(), target);
+  }
+
+  // sfixed64 timeStamp = 3;
+  if (this->_internal_timestamp() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteSFixed64ToArray(3, this->_internal_timestamp(), target);
+  }
+
+  // sfixed64 sequence_num = 4;
+  if (this->_internal_sequence_num() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteSFixed64ToArray(4, this->_internal_sequence_num(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:sensor_proto.proto_reading)
+  return target;
+}
+
+size_t proto_reading::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:sensor_proto.proto_reading)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // double value = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_value = this->_internal_value();
+  uint64_t raw_value;
+  memcpy(&raw_value, &tmp_value, sizeof(tmp_value));
+  if (raw_value != 0) {
+    total_size += 1 + 8;
+  }
+
+  // sfixed64 timeStamp = 3;
+  if (this->_internal_timestamp() != 0) {
+    total_size += 1 + 8;
+  }
+
+  // sfixed64 sequence_num = 4;
+  if (this->_internal_sequence_num() != 0) {
+    total_size += 1 + 8;
+  }
+
+  // fixed32 channel = 1;
+  if (this->_internal_channel() != 0) {
+    total_size += 1 + 4;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData proto_reading::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    proto_reading::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*proto_reading::GetClassData() const { return &_class_data_; }
+
+
+void proto_reading::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<proto_reading*>(&to_msg);
+  auto& from = static_cast<const proto_reading&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:sensor_proto.proto_reading)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_value = from._internal_value();
+  uint64_t raw_value;
+  memcpy(&raw_value, &tmp_value, sizeof(tmp_value));
+  if (raw_value != 0) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  if (from._internal_timestamp() != 0) {
+    _this->_internal_set_timestamp(from._internal_timestamp());
+  }
+  if (from._internal_sequence_num() != 0) {
+    _this->_internal_set_sequence_num(from._internal_sequence_num());
+  }
+  if (from._internal_channel() != 0) {
+    _this->_internal_set_channel(from._internal_channel());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void proto_reading::CopyFrom(const proto_reading& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:sensor_proto.proto_reading)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool proto_reading::IsInitialized() const {
+  return true;
+}
+
+void proto_reading::InternalSwap(proto_reading* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(proto_reading, _impl_.channel_)
+      + sizeof(proto_reading::_impl_.channel_)
+      - PROTOBUF_FIELD_OFFSET(proto_reading, _impl_.value_)>(
+          reinterpret_cast<char*>(&_impl_.value_),
+          reinterpret_cast<char*>(&other->_impl_.value_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata proto_reading::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_sensor_2eproto_getter, &descriptor_table_sensor_2eproto_once,
+      file_level_metadata_sensor_2eproto[2]);
+}
+
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace sensor_proto
 PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::sensor_proto::proto_serial_data* Arena::CreateMaybeMessage< ::sensor_proto::proto_serial_data >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::sensor_proto::proto_serial_data*
+Arena::CreateMaybeMessage< ::sensor_proto::proto_serial_data >(Arena* arena) {
   return Arena::CreateMessageInternal< ::sensor_proto::proto_serial_data >(arena);
 }
+template<> PROTOBUF_NOINLINE ::sensor_proto::proto_frame*
+Arena::CreateMaybeMessage< ::sensor_proto::proto_frame >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sensor_proto::proto_frame >(arena);
+}
+template<> PROTOBUF_NOINLINE ::sensor_proto::proto_reading*
+Arena::CreateMaybeMessage< ::sensor_proto::proto_reading >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sensor_proto::proto_reading >(arena);
+}
 PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3019000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3019006 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,7 +23,6 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
@@ -42,23 +41,23 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_sensor_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxiliaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[1]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
   static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_sensor_2eproto;
 namespace sensor_proto {
+class proto_frame;
+struct proto_frameDefaultTypeInternal;
+extern proto_frameDefaultTypeInternal _proto_frame_default_instance_;
+class proto_reading;
+struct proto_readingDefaultTypeInternal;
+extern proto_readingDefaultTypeInternal _proto_reading_default_instance_;
 class proto_serial_data;
 struct proto_serial_dataDefaultTypeInternal;
 extern proto_serial_dataDefaultTypeInternal _proto_serial_data_default_instance_;
 }  // namespace sensor_proto
 PROTOBUF_NAMESPACE_OPEN
+template<> ::sensor_proto::proto_frame* Arena::CreateMaybeMessage<::sensor_proto::proto_frame>(Arena*);
+template<> ::sensor_proto::proto_reading* Arena::CreateMaybeMessage<::sensor_proto::proto_reading>(Arena*);
 template<> ::sensor_proto::proto_serial_data* Arena::CreateMaybeMessage<::sensor_proto::proto_serial_data>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace sensor_proto {
@@ -70,7 +69,7 @@ class proto_serial_data final :
  public:
   inline proto_serial_data() : proto_serial_data(nullptr) {}
   ~proto_serial_data() override;
-  explicit constexpr proto_serial_data(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR proto_serial_data(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   proto_serial_data(const proto_serial_data& from);
   proto_serial_data(proto_serial_data&& from) noexcept
@@ -145,9 +144,11 @@ class proto_serial_data final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const proto_serial_data& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const proto_serial_data& from);
+  void MergeFrom( const proto_serial_data& from) {
+    proto_serial_data::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -156,10 +157,10 @@ class proto_serial_data final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(proto_serial_data* other);
@@ -172,9 +173,6 @@ class proto_serial_data final :
   protected:
   explicit proto_serial_data(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   public:
 
   static const ClassData _class_data_;
@@ -240,11 +238,493 @@ class proto_serial_data final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr sensor_id_;
-  double value_;
-  int64_t timestamp_;
-  int64_t sequence_num_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr sensor_id_;
+    double value_;
+    int64_t timestamp_;
+    int64_t sequence_num_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sensor_2eproto;
+};
+// -------------------------------------------------------------------
+
+class proto_frame final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sensor_proto.proto_frame) */ {
+ public:
+  inline proto_frame() : proto_frame(nullptr) {}
+  ~proto_frame() override;
+  explicit PROTOBUF_CONSTEXPR proto_frame(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  proto_frame(const proto_frame& from);
+  proto_frame(proto_frame&& from) noexcept
+    : proto_frame() {
+    *this = ::std::move(from);
+  }
+
+  inline proto_frame& operator=(const proto_frame& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline proto_frame& operator=(proto_frame&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const proto_frame& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const proto_frame* internal_default_instance() {
+    return reinterpret_cast<const proto_frame*>(
+               &_proto_frame_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(proto_frame& a, proto_frame& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(proto_frame* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(proto_frame* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  proto_frame* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<proto_frame>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const proto_frame& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const proto_frame& from) {
+    proto_frame::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(proto_frame* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sensor_proto.proto_frame";
+  }
+  protected:
+  explicit proto_frame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSensorsFieldNumber = 1,
+    kSensorIndexFieldNumber = 2,
+    kValueFieldNumber = 3,
+    kTimeStampFieldNumber = 4,
+    kSequenceNumFieldNumber = 5,
+    kReadingsFieldNumber = 7,
+    kCompressedFieldNumber = 6,
+  };
+  // repeated string sensors = 1;
+  int sensors_size() const;
+  private:
+  int _internal_sensors_size() const;
+  public:
+  void clear_sensors();
+  const std::string& sensors(int index) const;
+  std::string* mutable_sensors(int index);
+  void set_sensors(int index, const std::string& value);
+  void set_sensors(int index, std::string&& value);
+  void set_sensors(int index, const char* value);
+  void set_sensors(int index, const char* value, size_t size);
+  std::string* add_sensors();
+  void add_sensors(const std::string& value);
+  void add_sensors(std::string&& value);
+  void add_sensors(const char* value);
+  void add_sensors(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& sensors() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_sensors();
+  private:
+  const std::string& _internal_sensors(int index) const;
+  std::string* _internal_add_sensors();
+  public:
+
+  // repeated uint32 sensor_index = 2;
+  int sensor_index_size() const;
+  private:
+  int _internal_sensor_index_size() const;
+  public:
+  void clear_sensor_index();
+  private:
+  uint32_t _internal_sensor_index(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_sensor_index() const;
+  void _internal_add_sensor_index(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_sensor_index();
+  public:
+  uint32_t sensor_index(int index) const;
+  void set_sensor_index(int index, uint32_t value);
+  void add_sensor_index(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      sensor_index() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_sensor_index();
+
+  // repeated double value = 3;
+  int value_size() const;
+  private:
+  int _internal_value_size() const;
+  public:
+  void clear_value();
+  private:
+  double _internal_value(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      _internal_value() const;
+  void _internal_add_value(double value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      _internal_mutable_value();
+  public:
+  double value(int index) const;
+  void set_value(int index, double value);
+  void add_value(double value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      value() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      mutable_value();
+
+  // repeated int64 timeStamp = 4;
+  int timestamp_size() const;
+  private:
+  int _internal_timestamp_size() const;
+  public:
+  void clear_timestamp();
+  private:
+  int64_t _internal_timestamp(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      _internal_timestamp() const;
+  void _internal_add_timestamp(int64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      _internal_mutable_timestamp();
+  public:
+  int64_t timestamp(int index) const;
+  void set_timestamp(int index, int64_t value);
+  void add_timestamp(int64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      timestamp() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      mutable_timestamp();
+
+  // repeated int64 sequence_num = 5;
+  int sequence_num_size() const;
+  private:
+  int _internal_sequence_num_size() const;
+  public:
+  void clear_sequence_num();
+  private:
+  int64_t _internal_sequence_num(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      _internal_sequence_num() const;
+  void _internal_add_sequence_num(int64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      _internal_mutable_sequence_num();
+  public:
+  int64_t sequence_num(int index) const;
+  void set_sequence_num(int index, int64_t value);
+  void add_sequence_num(int64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      sequence_num() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      mutable_sequence_num();
+
+  // repeated .sensor_proto.proto_reading readings = 7;
+  int readings_size() const;
+  private:
+  int _internal_readings_size() const;
+  public:
+  void clear_readings();
+  ::sensor_proto::proto_reading* mutable_readings(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sensor_proto::proto_reading >*
+      mutable_readings();
+  private:
+  const ::sensor_proto::proto_reading& _internal_readings(int index) const;
+  ::sensor_proto::proto_reading* _internal_add_readings();
+  public:
+  const ::sensor_proto::proto_reading& readings(int index) const;
+  ::sensor_proto::proto_reading* add_readings();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sensor_proto::proto_reading >&
+      readings() const;
+
+  // bytes compressed = 6;
+  void clear_compressed();
+  const std::string& compressed() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_compressed(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_compressed();
+  PROTOBUF_NODISCARD std::string* release_compressed();
+  void set_allocated_compressed(std::string* compressed);
+  private:
+  const std::string& _internal_compressed() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_compressed(const std::string& value);
+  std::string* _internal_mutable_compressed();
+  public:
+
+  // @@protoc_insertion_point(class_scope:sensor_proto.proto_frame)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> sensors_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > sensor_index_;
+    mutable std::atomic<int> _sensor_index_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< double > value_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t > timestamp_;
+    mutable std::atomic<int> _timestamp_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t > sequence_num_;
+    mutable std::atomic<int> _sequence_num_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sensor_proto::proto_reading > readings_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr compressed_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sensor_2eproto;
+};
+// -------------------------------------------------------------------
+
+class proto_reading final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sensor_proto.proto_reading) */ {
+ public:
+  inline proto_reading() : proto_reading(nullptr) {}
+  ~proto_reading() override;
+  explicit PROTOBUF_CONSTEXPR proto_reading(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  proto_reading(const proto_reading& from);
+  proto_reading(proto_reading&& from) noexcept
+    : proto_reading() {
+    *this = ::std::move(from);
+  }
+
+  inline proto_reading& operator=(const proto_reading& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline proto_reading& operator=(proto_reading&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const proto_reading& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const proto_reading* internal_default_instance() {
+    return reinterpret_cast<const proto_reading*>(
+               &_proto_reading_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(proto_reading& a, proto_reading& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(proto_reading* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(proto_reading* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  proto_reading* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<proto_reading>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const proto_reading& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const proto_reading& from) {
+    proto_reading::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(proto_reading* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sensor_proto.proto_reading";
+  }
+  protected:
+  explicit proto_reading(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kValueFieldNumber = 2,
+    kTimeStampFieldNumber = 3,
+    kSequenceNumFieldNumber = 4,
+    kChannelFieldNumber = 1,
+  };
+  // double value = 2;
+  void clear_value();
+  double value() const;
+  void set_value(double value);
+  private:
+  double _internal_value() const;
+  void _internal_set_value(double value);
+  public:
+
+  // sfixed64 timeStamp = 3;
+  void clear_timestamp();
+  int64_t timestamp() const;
+  void set_timestamp(int64_t value);
+  private:
+  int64_t _internal_timestamp() const;
+  void _internal_set_timestamp(int64_t value);
+  public:
+
+  // sfixed64 sequence_num = 4;
+  void clear_sequence_num();
+  int64_t sequence_num() const;
+  void set_sequence_num(int64_t value);
+  private:
+  int64_t _internal_sequence_num() const;
+  void _internal_set_sequence_num(int64_t value);
+  public:
+
+  // fixed32 channel = 1;
+  void clear_channel();
+  uint32_t channel() const;
+  void set_channel(uint32_t value);
+  private:
+  uint32_t _internal_channel() const;
+  void _internal_set_channel(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:sensor_proto.proto_reading)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    double value_;
+    int64_t timestamp_;
+    int64_t sequence_num_;
+    uint32_t channel_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_sensor_2eproto;
 };
 // ===================================================================
@@ -260,7 +740,7 @@ class proto_serial_data final :
 
 // string sensor_id = 1;
 inline void proto_serial_data::clear_sensor_id() {
-  sensor_id_.ClearToEmpty();
+  _impl_.sensor_id_.ClearToEmpty();
 }
 inline const std::string& proto_serial_data::sensor_id() const {
   // @@protoc_insertion_point(field_get:sensor_proto.proto_serial_data.sensor_id)
@@ -270,7 +750,7 @@ template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void proto_serial_data::set_sensor_id(ArgT0&& arg0, ArgT... args) {
  
- sensor_id_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_.sensor_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:sensor_proto.proto_serial_data.sensor_id)
 }
 inline std::string* proto_serial_data::mutable_sensor_id() {
@@ -279,19 +759,19 @@ inline std::string* proto_serial_data::mutable_sensor_id() {
   return _s;
 }
 inline const std::string& proto_serial_data::_internal_sensor_id() const {
-  return sensor_id_.Get();
+  return _impl_.sensor_id_.Get();
 }
 inline void proto_serial_data::_internal_set_sensor_id(const std::string& value) {
   
-  sensor_id_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
+  _impl_.sensor_id_.Set(value, GetArenaForAllocation());
 }
 inline std::string* proto_serial_data::_internal_mutable_sensor_id() {
   
-  return sensor_id_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
+  return _impl_.sensor_id_.Mutable(GetArenaForAllocation());
 }
 inline std::string* proto_serial_data::release_sensor_id() {
   // @@protoc_insertion_point(field_release:sensor_proto.proto_serial_data.sensor_id)
-  return sensor_id_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
+  return _impl_.sensor_id_.Release();
 }
 inline void proto_serial_data::set_allocated_sensor_id(std::string* sensor_id) {
   if (sensor_id != nullptr) {
@@ -299,11 +779,10 @@ inline void proto_serial_data::set_allocated_sensor_id(std::string* sensor_id) {
   } else {
     
   }
-  sensor_id_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), sensor_id,
-      GetArenaForAllocation());
+  _impl_.sensor_id_.SetAllocated(sensor_id, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (sensor_id_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
-    sensor_id_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+  if (_impl_.sensor_id_.IsDefault()) {
+    _impl_.sensor_id_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:sensor_proto.proto_serial_data.sensor_id)
@@ -311,10 +790,10 @@ inline void proto_serial_data::set_allocated_sensor_id(std::string* sensor_id) {
 
 // double value = 2;
 inline void proto_serial_data::clear_value() {
-  value_ = 0;
+  _impl_.value_ = 0;
 }
 inline double proto_serial_data::_internal_value() const {
-  return value_;
+  return _impl_.value_;
 }
 inline double proto_serial_data::value() const {
   // @@protoc_insertion_point(field_get:sensor_proto.proto_serial_data.value)
@@ -322,7 +801,7 @@ inline double proto_serial_data::value() const {
 }
 inline void proto_serial_data::_internal_set_value(double value) {
   
-  value_ = value;
+  _impl_.value_ = value;
 }
 inline void proto_serial_data::set_value(double value) {
   _internal_set_value(value);
@@ -331,10 +810,10 @@ inline void proto_serial_data::set_value(double value) {
 
 // int64 timeStamp = 3;
 inline void proto_serial_data::clear_timestamp() {
-  timestamp_ = int64_t{0};
+  _impl_.timestamp_ = int64_t{0};
 }
 inline int64_t proto_serial_data::_internal_timestamp() const {
-  return timestamp_;
+  return _impl_.timestamp_;
 }
 inline int64_t proto_serial_data::timestamp() const {
   // @@protoc_insertion_point(field_get:sensor_proto.proto_serial_data.timeStamp)
@@ -342,7 +821,7 @@ inline int64_t proto_serial_data::timestamp() const {
 }
 inline void proto_serial_data::_internal_set_timestamp(int64_t value) {
   
-  timestamp_ = value;
+  _impl_.timestamp_ = value;
 }
 inline void proto_serial_data::set_timestamp(int64_t value) {
   _internal_set_timestamp(value);
@@ -351,10 +830,10 @@ inline void proto_serial_data::set_timestamp(int64_t value) {
 
 // int64 sequence_num = 4;
 inline void proto_serial_data::clear_sequence_num() {
-  sequence_num_ = int64_t{0};
+  _impl_.sequence_num_ = int64_t{0};
 }
 inline int64_t proto_serial_data::_internal_sequence_num() const {
-  return sequence_num_;
+  return _impl_.sequence_num_;
 }
 inline int64_t proto_serial_data::sequence_num() const {
   // @@protoc_insertion_point(field_get:sensor_proto.proto_serial_data.sequence_num)
@@ -362,16 +841,461 @@ inline int64_t proto_serial_data::sequence_num() const {
 }
 inline void proto_serial_data::_internal_set_sequence_num(int64_t value) {
   
-  sequence_num_ = value;
+  _impl_.sequence_num_ = value;
 }
 inline void proto_serial_data::set_sequence_num(int64_t value) {
   _internal_set_sequence_num(value);
   // @@protoc_insertion_point(field_set:sensor_proto.proto_serial_data.sequence_num)
 }
 
+// -------------------------------------------------------------------
+
+// proto_frame
+
+// repeated string sensors = 1;
+inline int proto_frame::_internal_sensors_size() const {
+  return _impl_.sensors_.size();
+}
+inline int proto_frame::sensors_size() const {
+  return _internal_sensors_size();
+}
+inline void proto_frame::clear_sensors() {
+  _impl_.sensors_.Clear();
+}
+inline std::string* proto_frame::add_sensors() {
+  std::string* _s = _internal_add_sensors();
+  // @@protoc_insertion_point(field_add_mutable:sensor_proto.proto_frame.sensors)
+  return _s;
+}
+inline const std::string& proto_frame::_internal_sensors(int index) const {
+  return _impl_.sensors_.Get(index);
+}
+inline const std::string& proto_frame::sensors(int index) const {
+  // @@protoc_insertion_point(field_get:sensor_proto.proto_frame.sensors)
+  return _internal_sensors(index);
+}
+inline std::string* proto_frame::mutable_sensors(int index) {
+  // @@protoc_insertion_point(field_mutable:sensor_proto.proto_frame.sensors)
+  return _impl_.sensors_.Mutable(index);
+}
+inline void proto_frame::set_sensors(int index, const std::string& value) {
+  _impl_.sensors_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:sensor_proto.proto_frame.sensors)
+}
+inline void proto_frame::set_sensors(int index, std::string&& value) {
+  _impl_.sensors_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:sensor_proto.proto_frame.sensors)
+}
+inline void proto_frame::set_sensors(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.sensors_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:sensor_proto.proto_frame.sensors)
+}
+inline void proto_frame::set_sensors(int index, const char* value, size_t size) {
+  _impl_.sensors_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:sensor_proto.proto_frame.sensors)
+}
+inline std::string* proto_frame::_internal_add_sensors() {
+  return _impl_.sensors_.Add();
+}
+inline void proto_frame::add_sensors(const std::string& value) {
+  _impl_.sensors_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:sensor_proto.proto_frame.sensors)
+}
+inline void proto_frame::add_sensors(std::string&& value) {
+  _impl_.sensors_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:sensor_proto.proto_frame.sensors)
+}
+inline void proto_frame::add_sensors(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.sensors_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:sensor_proto.proto_frame.sensors)
+}
+inline void proto_frame::add_sensors(const char* value, size_t size) {
+  _impl_.sensors_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:sensor_proto.proto_frame.sensors)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+proto_frame::sensors() const {
+  // @@protoc_insertion_point(field_list:sensor_proto.proto_frame.sensors)
+  return _impl_.sensors_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+proto_frame::mutable_sensors() {
+  // @@protoc_insertion_point(field_mutable_list:sensor_proto.proto_frame.sensors)
+  return &_impl_.sensors_;
+}
+
+// repeated uint32 sensor_index = 2;
+inline int proto_frame::_internal_sensor_index_size() const {
+  return _impl_.sensor_index_.size();
+}
+inline int proto_frame::sensor_index_size() const {
+  return _internal_sensor_index_size();
+}
+inline void proto_frame::clear_sensor_index() {
+  _impl_.sensor_index_.Clear();
+}
+inline uint32_t proto_frame::_internal_sensor_index(int index) const {
+  return _impl_.sensor_index_.Get(index);
+}
+inline uint32_t proto_frame::sensor_index(int index) const {
+  // @@protoc_insertion_point(field_get:sensor_proto.proto_frame.sensor_index)
+  return _internal_sensor_index(index);
+}
+inline void proto_frame::set_sensor_index(int index, uint32_t value) {
+  _impl_.sensor_index_.Set(index, value);
+  // @@protoc_insertion_point(field_set:sensor_proto.proto_frame.sensor_index)
+}
+inline void proto_frame::_internal_add_sensor_index(uint32_t value) {
+  _impl_.sensor_index_.Add(value);
+}
+inline void proto_frame::add_sensor_index(uint32_t value) {
+  _internal_add_sensor_index(value);
+  // @@protoc_insertion_point(field_add:sensor_proto.proto_frame.sensor_index)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+proto_frame::_internal_sensor_index() const {
+  return _impl_.sensor_index_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+proto_frame::sensor_index() const {
+  // @@protoc_insertion_point(field_list:sensor_proto.proto_frame.sensor_index)
+  return _internal_sensor_index();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+proto_frame::_internal_mutable_sensor_index() {
+  return &_impl_.sensor_index_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+proto_frame::mutable_sensor_index() {
+  // @@protoc_insertion_point(field_mutable_list:sensor_proto.proto_frame.sensor_index)
+  return _internal_mutable_sensor_index();
+}
+
+// repeated double value = 3;
+inline int proto_frame::_internal_value_size() const {
+  return _impl_.value_.size();
+}
+inline int proto_frame::value_size() const {
+  return _internal_value_size();
+}
+inline void proto_frame::clear_value() {
+  _impl_.value_.Clear();
+}
+inline double proto_frame::_internal_value(int index) const {
+  return _impl_.value_.Get(index);
+}
+inline double proto_frame::value(int index) const {
+  // @@protoc_insertion_point(field_get:sensor_proto.proto_frame.value)
+  return _internal_value(index);
+}
+inline void proto_frame::set_value(int index, double value) {
+  _impl_.value_.Set(index, value);
+  // @@protoc_insertion_point(field_set:sensor_proto.proto_frame.value)
+}
+inline void proto_frame::_internal_add_value(double value) {
+  _impl_.value_.Add(value);
+}
+inline void proto_frame::add_value(double value) {
+  _internal_add_value(value);
+  // @@protoc_insertion_point(field_add:sensor_proto.proto_frame.value)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+proto_frame::_internal_value() const {
+  return _impl_.value_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+proto_frame::value() const {
+  // @@protoc_insertion_point(field_list:sensor_proto.proto_frame.value)
+  return _internal_value();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+proto_frame::_internal_mutable_value() {
+  return &_impl_.value_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+proto_frame::mutable_value() {
+  // @@protoc_insertion_point(field_mutable_list:sensor_proto.proto_frame.value)
+  return _internal_mutable_value();
+}
+
+// repeated int64 timeStamp = 4;
+inline int proto_frame::_internal_timestamp_size() const {
+  return _impl_.timestamp_.size();
+}
+inline int proto_frame::timestamp_size() const {
+  return _internal_timestamp_size();
+}
+inline void proto_frame::clear_timestamp() {
+  _impl_.timestamp_.Clear();
+}
+inline int64_t proto_frame::_internal_timestamp(int index) const {
+  return _impl_.timestamp_.Get(index);
+}
+inline int64_t proto_frame::timestamp(int index) const {
+  // @@protoc_insertion_point(field_get:sensor_proto.proto_frame.timeStamp)
+  return _internal_timestamp(index);
+}
+inline void proto_frame::set_timestamp(int index, int64_t value) {
+  _impl_.timestamp_.Set(index, value);
+  // @@protoc_insertion_point(field_set:sensor_proto.proto_frame.timeStamp)
+}
+inline void proto_frame::_internal_add_timestamp(int64_t value) {
+  _impl_.timestamp_.Add(value);
+}
+inline void proto_frame::add_timestamp(int64_t value) {
+  _internal_add_timestamp(value);
+  // @@protoc_insertion_point(field_add:sensor_proto.proto_frame.timeStamp)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+proto_frame::_internal_timestamp() const {
+  return _impl_.timestamp_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+proto_frame::timestamp() const {
+  // @@protoc_insertion_point(field_list:sensor_proto.proto_frame.timeStamp)
+  return _internal_timestamp();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+proto_frame::_internal_mutable_timestamp() {
+  return &_impl_.timestamp_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+proto_frame::mutable_timestamp() {
+  // @@protoc_insertion_point(field_mutable_list:sensor_proto.proto_frame.timeStamp)
+  return _internal_mutable_timestamp();
+}
+
+// repeated int64 sequence_num = 5;
+inline int proto_frame::_internal_sequence_num_size() const {
+  return _impl_.sequence_num_.size();
+}
+inline int proto_frame::sequence_num_size() const {
+  return _internal_sequence_num_size();
+}
+inline void proto_frame::clear_sequence_num() {
+  _impl_.sequence_num_.Clear();
+}
+inline int64_t proto_frame::_internal_sequence_num(int index) const {
+  return _impl_.sequence_num_.Get(index);
+}
+inline int64_t proto_frame::sequence_num(int index) const {
+  // @@protoc_insertion_point(field_get:sensor_proto.proto_frame.sequence_num)
+  return _internal_sequence_num(index);
+}
+inline void proto_frame::set_sequence_num(int index, int64_t value) {
+  _impl_.sequence_num_.Set(index, value);
+  // @@protoc_insertion_point(field_set:sensor_proto.proto_frame.sequence_num)
+}
+inline void proto_frame::_internal_add_sequence_num(int64_t value) {
+  _impl_.sequence_num_.Add(value);
+}
+inline void proto_frame::add_sequence_num(int64_t value) {
+  _internal_add_sequence_num(value);
+  // @@protoc_insertion_point(field_add:sensor_proto.proto_frame.sequence_num)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+proto_frame::_internal_sequence_num() const {
+  return _impl_.sequence_num_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+proto_frame::sequence_num() const {
+  // @@protoc_insertion_point(field_list:sensor_proto.proto_frame.sequence_num)
+  return _internal_sequence_num();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+proto_frame::_internal_mutable_sequence_num() {
+  return &_impl_.sequence_num_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+proto_frame::mutable_sequence_num() {
+  // @@protoc_insertion_point(field_mutable_list:sensor_proto.proto_frame.sequence_num)
+  return _internal_mutable_sequence_num();
+}
+
+// bytes compressed = 6;
+inline void proto_frame::clear_compressed() {
+  _impl_.compressed_.ClearToEmpty();
+}
+inline const std::string& proto_frame::compressed() const {
+  // @@protoc_insertion_point(field_get:sensor_proto.proto_frame.compressed)
+  return _internal_compressed();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void proto_frame::set_compressed(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.compressed_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:sensor_proto.proto_frame.compressed)
+}
+inline std::string* proto_frame::mutable_compressed() {
+  std::string* _s = _internal_mutable_compressed();
+  // @@protoc_insertion_point(field_mutable:sensor_proto.proto_frame.compressed)
+  return _s;
+}
+inline const std::string& proto_frame::_internal_compressed() const {
+  return _impl_.compressed_.Get();
+}
+inline void proto_frame::_internal_set_compressed(const std::string& value) {
+  
+  _impl_.compressed_.Set(value, GetArenaForAllocation());
+}
+inline std::string* proto_frame::_internal_mutable_compressed() {
+  
+  return _impl_.compressed_.Mutable(GetArenaForAllocation());
+}
+inline std::string* proto_frame::release_compressed() {
+  // @@protoc_insertion_point(field_release:sensor_proto.proto_frame.compressed)
+  return _impl_.compressed_.Release();
+}
+inline void proto_frame::set_allocated_compressed(std::string* compressed) {
+  if (compressed != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.compressed_.SetAllocated(compressed, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.compressed_.IsDefault()) {
+    _impl_.compressed_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:sensor_proto.proto_frame.compressed)
+}
+
+// repeated .sensor_proto.proto_reading readings = 7;
+inline int proto_frame::_internal_readings_size() const {
+  return _impl_.readings_.size();
+}
+inline int proto_frame::readings_size() const {
+  return _internal_readings_size();
+}
+inline void proto_frame::clear_readings() {
+  _impl_.readings_.Clear();
+}
+inline ::sensor_proto::proto_reading* proto_frame::mutable_readings(int index) {
+  // @@protoc_insertion_point(field_mutable:sensor_proto.proto_frame.readings)
+  return _impl_.readings_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sensor_proto::proto_reading >*
+proto_frame::mutable_readings() {
+  // @@protoc_insertion_point(field_mutable_list:sensor_proto.proto_frame.readings)
+  return &_impl_.readings_;
+}
+inline const ::sensor_proto::proto_reading& proto_frame::_internal_readings(int index) const {
+  return _impl_.readings_.Get(index);
+}
+inline const ::sensor_proto::proto_reading& proto_frame::readings(int index) const {
+  // @@protoc_insertion_point(field_get:sensor_proto.proto_frame.readings)
+  return _internal_readings(index);
+}
+inline ::sensor_proto::proto_reading* proto_frame::_internal_add_readings() {
+  return _impl_.readings_.Add();
+}
+inline ::sensor_proto::proto_reading* proto_frame::add_readings() {
+  ::sensor_proto::proto_reading* _add = _internal_add_readings();
+  // @@protoc_insertion_point(field_add:sensor_proto.proto_frame.readings)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sensor_proto::proto_reading >&
+proto_frame::readings() const {
+  // @@protoc_insertion_point(field_list:sensor_proto.proto_frame.readings)
+  return _impl_.readings_;
+}
+
+// -------------------------------------------------------------------
+
+// proto_reading
+
+// fixed32 channel = 1;
+inline void proto_reading::clear_channel() {
+  _impl_.channel_ = 0u;
+}
+inline uint32_t proto_reading::_internal_channel() const {
+  return _impl_.channel_;
+}
+inline uint32_t proto_reading::channel() const {
+  // @@protoc_insertion_point(field_get:sensor_proto.proto_reading.channel)
+  return _internal_channel();
+}
+inline void proto_reading::_internal_set_channel(uint32_t value) {
+  
+  _impl_.channel_ = value;
+}
+inline void proto_reading::set_channel(uint32_t value) {
+  _internal_set_channel(value);
+  // @@protoc_insertion_point(field_set:sensor_proto.proto_reading.channel)
+}
+
+// double value = 2;
+inline void proto_reading::clear_value() {
+  _impl_.value_ = 0;
+}
+inline double proto_reading::_internal_value() const {
+  return _impl_.value_;
+}
+inline double proto_reading::value() const {
+  // @@protoc_insertion_point(field_get:sensor_proto.proto_reading.value)
+  return _internal_value();
+}
+inline void proto_reading::_internal_set_value(double value) {
+  
+  _impl_.value_ = value;
+}
+inline void proto_reading::set_value(double value) {
+  _internal_set_value(value);
+  // @@protoc_insertion_point(field_set:sensor_proto.proto_reading.value)
+}
+
+// sfixed64 timeStamp = 3;
+inline void proto_reading::clear_timestamp() {
+  _impl_.timestamp_ = int64_t{0};
+}
+inline int64_t proto_reading::_internal_timestamp() const {
+  return _impl_.timestamp_;
+}
+inline int64_t proto_reading::timestamp() const {
+  // @@protoc_insertion_point(field_get:sensor_proto.proto_reading.timeStamp)
+  return _internal_timestamp();
+}
+inline void proto_reading::_internal_set_timestamp(int64_t value) {
+  
+  _impl_.timestamp_ = value;
+}
+inline void proto_reading::set_timestamp(int64_t value) {
+  _internal_set_timestamp(value);
+  // @@protoc_insertion_point(field_set:sensor_proto.proto_reading.timeStamp)
+}
+
+// sfixed64 sequence_num = 4;
+inline void proto_reading::clear_sequence_num() {
+  _impl_.sequence_num_ = int64_t{0};
+}
+inline int64_t proto_reading::_internal_sequence_num() const {
+  return _impl_.sequence_num_;
+}
+inline int64_t proto_reading::sequence_num() const {
+  // @@protoc_insertion_point(field_get:sensor_proto.proto_reading.sequence_num)
+  return _internal_sequence_num();
+}
+inline void proto_reading::_internal_set_sequence_num(int64_t value) {
+  
+  _impl_.sequence_num_ = value;
+}
+inline void proto_reading::set_sequence_num(int64_t value) {
+  _internal_set_sequence_num(value);
+  // @@protoc_insertion_point(field_set:sensor_proto.proto_reading.sequence_num)
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// Assigns compact integer ids to channel (sensor) names. Ids are dense, in
+// registration order, so per-channel state can live in plain vectors indexed by
+// id and only the integer has to travel with each reading. Not synchronised:
+// channels are registered before the pipeline starts and only looked up after.
+class channelRegistry {
+private:
+    std::vector<std::string> m_names;
+    std::unordered_map<std::string, uint32_t> m_ids;
+
+public:
+    // Returns the name's id, registering it on first use
+    uint32_t intern(std::string_view name){
+        uint32_t id;
+        if (find(name, id)) return id;
+        id = static_cast<uint32_t>(m_names.size());
+        m_names.emplace_back(name);
+        m_ids.emplace(m_names.back(), id);
+        return id;
+    }
+
+    bool find(std::string_view name, uint32_t& id) const {
+        const auto found = m_ids.find(std::string(name));
+        if (found == m_ids.end()) return false;
+        id = found->second;
+        return true;
+    }
+
+    const std::string& name(uint32_t id) const { return m_names[id]; }
+    size_t size() const { return m_names.size(); }
+    const std::vector<std::string>& names() const { return m_names; }
+};
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "spsc_ring_buffer.h"
+
+// Puts a shardedAggregator's output back into per-channel order. A pool channel is
+// drained by one worker at a time, but a steal can move it to another worker whose
+// output link the consumer reaches first. The worker holding a channel stamps each
+// output with next(channel); drain() hands an item on only when it is the next one
+// of its channel and otherwise leaves that link for the next pass.
+class channelSequencer {
+private:
+    std::vector<uint64_t> m_issued;     // written by the worker holding the channel
+    std::vector<uint64_t> m_expected;   // written by the consumer
+
+public:
+    explicit channelSequencer(size_t channels) : m_issued(channels, 0), m_expected(channels, 0) {}
+
+    // Producer side; only the worker currently holding the channel may call it
+    uint64_t next(size_t channel){
+        return m_issued[channel]++;
+    }
+
+    // Consumer side. Calls f(T&) in place on up to max_per_link items of each link;
+    // order_of(const T&) gives the item's pool channel and stamp. waiting is set when
+    // a link stopped at an item whose predecessor sits in another link: call again
+    // rather than sleep. Returns the number of items handed to f.
+    template <typename T, typename Order, typename F>
+    size_t drain(std::vector<std::unique_ptr<spscRingBuffer<T>>>& links, size_t max_per_link,
+                 Order&& order_of, F&& f, bool& waiting){
+        waiting = false;
+        size_t handed = 0;
+        for (auto& link : links) {
+            handed += link->consume_while([&](T& item){
+                const auto [channel, sequence] = order_of(static_cast<const T&>(item));
+                if (sequence != m_expected[channel]) {
+                    waiting = true;
+                    return false;
+                }
+                m_expected[channel]++;
+                f(item);
+                return true;
+            }, max_per_link);
+        }
+        return handed;
+    }
+};
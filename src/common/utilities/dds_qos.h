@@ -0,0 +1,24 @@
+#pragma once
+
+#include "dds/dds.hpp"
+#include "qos_profile.h"
+
+// A DataWriterQos or DataReaderQos carrying the profile's policies; anything the
+// profile leaves at 0 keeps the DDS default
+template <typename Qos>
+Qos make_dds_qos(const qosProfile& profile){
+    Qos qos;
+    if (profile.reliable) qos << dds::core::policy::Reliability::Reliable();
+    else qos << dds::core::policy::Reliability::BestEffort();
+    if (profile.transient_local) qos << dds::core::policy::Durability::TransientLocal();
+    else qos << dds::core::policy::Durability::Volatile();
+    if (profile.history_depth > 0) qos << dds::core::policy::History::KeepLast(profile.history_depth);
+    else qos << dds::core::policy::History::KeepAll();
+    if (profile.deadline_ms > 0) {
+        qos << dds::core::policy::Deadline(dds::core::Duration::from_millisecs(profile.deadline_ms));
+    }
+    if (profile.latency_budget_ms > 0) {
+        qos << dds::core::policy::LatencyBudget(dds::core::Duration::from_millisecs(profile.latency_budget_ms));
+    }
+    return qos;
+}
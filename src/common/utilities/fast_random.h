@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+inline uint64_t splitmix64(uint64_t& state){
+    uint64_t z = (state += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+inline uint64_t rotl64(uint64_t x, int k){
+    return (x << k) | (x >> (64 - k));
+}
+
+// Upper 53 bits of a random word as a double in [0, 1)
+inline double unit_double(uint64_t bits){
+    return static_cast<double>(bits >> 11) * 0x1.0p-53;
+}
+
+// xoshiro256**: a few ns per number, no syscalls and no shared state. Meets the
+// UniformRandomBitGenerator requirements, so it drops into <random> distributions.
+// Not for anything security related.
+class xoshiro256 {
+private:
+    uint64_t m_s[4];
+
+public:
+    using result_type = uint64_t;
+
+    explicit xoshiro256(uint64_t seed = 0x5eed){
+        for (auto& word : m_s) word = splitmix64(seed);
+    }
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    result_type operator()(){
+        const uint64_t result = rotl64(m_s[1] * 5, 7) * 9;
+        const uint64_t t = m_s[1] << 17;
+        m_s[2] ^= m_s[0];
+        m_s[3] ^= m_s[1];
+        m_s[1] ^= m_s[2];
+        m_s[0] ^= m_s[3];
+        m_s[2] ^= t;
+        m_s[3] = rotl64(m_s[3], 45);
+        return result;
+    }
+
+    double next_double(){
+        return unit_double((*this)());
+    }
+};
+
+// LANES independent xoshiro256+ streams stepped in lockstep for bulk generation.
+// The per-lane loops carry no dependency across lanes and use only shifts, xors
+// and adds, so the compiler vectorizes them (4 x 64-bit lanes fill one AVX2 register).
+class xoshiroBatch {
+public:
+    static constexpr size_t LANES = 4;
+
+private:
+    uint64_t m_s0[LANES], m_s1[LANES], m_s2[LANES], m_s3[LANES];
+
+    void step(uint64_t (&out)[LANES]){
+        for (size_t l = 0; l < LANES; ++l) {
+            out[l] = m_s0[l] + m_s3[l];
+            const uint64_t t = m_s1[l] << 17;
+            m_s2[l] ^= m_s0[l];
+            m_s3[l] ^= m_s1[l];
+            m_s1[l] ^= m_s2[l];
+            m_s0[l] ^= m_s3[l];
+            m_s2[l] ^= t;
+            m_s3[l] = (m_s3[l] << 45) | (m_s3[l] >> 19);
+        }
+    }
+
+public:
+    explicit xoshiroBatch(uint64_t seed = 0x5eed){
+        for (size_t l = 0; l < LANES; ++l) {
+            m_s0[l] = splitmix64(seed);
+            m_s1[l] = splitmix64(seed);
+            m_s2[l] = splitmix64(seed);
+            m_s3[l] = splitmix64(seed);
+        }
+    }
+
+    // Fills out[0..n) with uniform doubles in [0, 1)
+    void fill_unit(double* out, size_t n){
+        uint64_t bits[LANES];
+        size_t i = 0;
+        for (; i + LANES <= n; i += LANES) {
+            step(bits);
+            for (size_t l = 0; l < LANES; ++l) out[i + l] = unit_double(bits[l]);
+        }
+        if (i < n) {
+            step(bits);
+            for (size_t l = 0; i < n; ++l, ++i) out[i] = unit_double(bits[l]);
+        }
+    }
+};
@@ -0,0 +1,349 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// Gorilla-style compression for regular time series (Pelkonen et al., VLDB 2015).
+// Per reading of one series:
+//   timestamp     delta-of-delta in a prefix-coded bucket, 1 bit when the period holds
+//   value         XOR with the previous value, 1 bit when unchanged, otherwise only
+//                 the meaningful bits, reusing the previous leading/trailing window
+//   sequence_num  delta-of-delta like the timestamp, 1 bit for +1 steps
+// The first reading of a series is stored raw. Series are self-contained, so a
+// lost frame never corrupts the next one.
+
+// Bytes is any byte container with push_back, e.g. std::vector<uint8_t> or std::string
+template <typename Bytes>
+void gorilla_put_varint(Bytes& out, uint64_t v){
+    using byte_t = typename Bytes::value_type;
+    while (v >= 0x80) {
+        out.push_back(static_cast<byte_t>(static_cast<uint8_t>(v | 0x80)));
+        v >>= 7;
+    }
+    out.push_back(static_cast<byte_t>(static_cast<uint8_t>(v)));
+}
+
+inline bool gorilla_get_varint(const uint8_t*& p, const uint8_t* end, uint64_t& v){
+    v = 0;
+    for (int shift = 0; shift < 64 && p < end; shift += 7) {
+        const uint8_t byte = *p++;
+        v |= uint64_t(byte & 0x7f) << shift;
+        if (!(byte & 0x80)) return true;
+    }
+    return false;
+}
+
+// MSB-first bit stream into a byte vector that keeps its capacity across reset()
+class gorillaBitWriter {
+private:
+    std::vector<uint8_t> m_out;
+    int m_free = 0;   // unused low bits in the last byte
+
+public:
+    void reset(){
+        m_out.clear();
+        m_free = 0;
+    }
+
+    const std::vector<uint8_t>& bytes() const { return m_out; }
+
+    void write(uint64_t bits, int count){
+        while (count > 0) {
+            if (m_free == 0) {
+                m_out.push_back(0);
+                m_free = 8;
+            }
+            const int take = count < m_free ? count : m_free;
+            const uint64_t chunk = (bits >> (count - take)) & ((uint64_t(1) << take) - 1);
+            m_out.back() |= static_cast<uint8_t>(chunk << (m_free - take));
+            m_free -= take;
+            count -= take;
+        }
+    }
+};
+
+class gorillaBitReader {
+private:
+    const uint8_t* m_data;
+    size_t m_bits;
+    size_t m_pos = 0;
+
+public:
+    gorillaBitReader(const uint8_t* data, size_t size) : m_data(data), m_bits(size * 8) {}
+
+    // False when the stream runs out
+    bool read(int count, uint64_t& bits){
+        if (m_pos + static_cast<size_t>(count) > m_bits) return false;
+        bits = 0;
+        while (count > 0) {
+            const size_t byte = m_pos >> 3;
+            const int offset = static_cast<int>(m_pos & 7);
+            const int avail = 8 - offset;
+            const int take = count < avail ? count : avail;
+            const uint64_t chunk = (m_data[byte] >> (avail - take)) & ((1u << take) - 1);
+            bits = (bits << take) | chunk;
+            m_pos += take;
+            count -= take;
+        }
+        return true;
+    }
+};
+
+namespace gorilla_detail {
+
+inline uint64_t double_bits(double v){
+    uint64_t bits;
+    std::memcpy(&bits, &v, sizeof bits);
+    return bits;
+}
+
+inline double bits_double(uint64_t bits){
+    double v;
+    std::memcpy(&v, &bits, sizeof v);
+    return v;
+}
+
+// Deltas wrap like the unsigned arithmetic they are stored as, so any int64 input round-trips
+inline int64_t wrapping_sub(int64_t a, int64_t b){
+    return static_cast<int64_t>(static_cast<uint64_t>(a) - static_cast<uint64_t>(b));
+}
+
+inline int64_t wrapping_add(int64_t a, int64_t b){
+    return static_cast<int64_t>(static_cast<uint64_t>(a) + static_cast<uint64_t>(b));
+}
+
+inline bool fits(int64_t v, int width){
+    const int64_t lo = -(int64_t(1) << (width - 1));
+    const int64_t hi = (int64_t(1) << (width - 1)) - 1;
+    return v >= lo && v <= hi;
+}
+
+inline int64_t sign_extend(uint64_t v, int width){
+    const uint64_t sign = uint64_t(1) << (width - 1);
+    return static_cast<int64_t>((v ^ sign) - sign);
+}
+
+// '0' | '10'+7 | '110'+9 | '1110'+12 | '1111'+64
+inline void put_dod(gorillaBitWriter& w, int64_t dod){
+    if (dod == 0) w.write(0, 1);
+    else if (fits(dod, 7)) { w.write(0b10, 2); w.write(static_cast<uint64_t>(dod), 7); }
+    else if (fits(dod, 9)) { w.write(0b110, 3); w.write(static_cast<uint64_t>(dod), 9); }
+    else if (fits(dod, 12)) { w.write(0b1110, 4); w.write(static_cast<uint64_t>(dod), 12); }
+    else { w.write(0b1111, 4); w.write(static_cast<uint64_t>(dod), 64); }
+}
+
+inline bool get_dod(gorillaBitReader& r, int64_t& dod){
+    static constexpr int widths[] = {7, 9, 12, 64};
+    uint64_t bit;
+    int prefix = 0;
+    while (prefix < 4) {
+        if (!r.read(1, bit)) return false;
+        if (bit == 0) break;
+        prefix++;
+    }
+    if (prefix == 0) {
+        dod = 0;
+        return true;
+    }
+    const int width = widths[prefix - 1];
+    uint64_t v;
+    if (!r.read(width, v)) return false;
+    dod = width == 64 ? static_cast<int64_t>(v) : sign_extend(v, width);
+    return true;
+}
+
+inline int leading_zeros(uint64_t v){ return v ? __builtin_clzll(v) : 64; }
+inline int trailing_zeros(uint64_t v){ return v ? __builtin_ctzll(v) : 64; }
+
+}  // namespace gorilla_detail
+
+// Streams one series into its own byte buffer; readings can be appended as they arrive
+class gorillaSeriesEncoder {
+private:
+    gorillaBitWriter m_writer;
+    size_t m_count = 0;
+    int64_t m_prev_ts = 0, m_prev_delta = 0;
+    int64_t m_prev_seq = 0, m_prev_seq_delta = 1;
+    uint64_t m_prev_value = 0;
+    int m_leading = -1, m_trailing = 0;
+
+public:
+    gorillaSeriesEncoder(){
+        reset();
+    }
+
+    // Keeps the buffer's capacity
+    void reset(){
+        m_writer.reset();
+        m_count = 0;
+        m_prev_delta = 0;
+        m_prev_seq_delta = 1;
+        m_leading = -1;
+    }
+
+    void append(int64_t ts, double value, int64_t seq){
+        using namespace gorilla_detail;
+        const uint64_t bits = double_bits(value);
+        if (m_count == 0) {
+            m_writer.write(static_cast<uint64_t>(ts), 64);
+            m_writer.write(bits, 64);
+            m_writer.write(static_cast<uint64_t>(seq), 64);
+        } else {
+            const int64_t delta = wrapping_sub(ts, m_prev_ts);
+            put_dod(m_writer, wrapping_sub(delta, m_prev_delta));
+            m_prev_delta = delta;
+
+            const uint64_t x = bits ^ m_prev_value;
+            if (x == 0) {
+                m_writer.write(0, 1);
+            } else {
+                int leading = leading_zeros(x);
+                const int trailing = trailing_zeros(x);
+                if (leading > 31) leading = 31;
+                if (m_leading >= 0 && leading >= m_leading && trailing >= m_trailing) {
+                    m_writer.write(0b10, 2);
+                    m_writer.write(x >> m_trailing, 64 - m_leading - m_trailing);
+                } else {
+                    const int meaningful = 64 - leading - trailing;
+                    m_writer.write(0b11, 2);
+                    m_writer.write(static_cast<uint64_t>(leading), 5);
+                    m_writer.write(static_cast<uint64_t>(meaningful & 63), 6);   // 64 is sent as 0
+                    m_writer.write(x >> trailing, meaningful);
+                    m_leading = leading;
+                    m_trailing = trailing;
+                }
+            }
+
+            const int64_t seq_delta = wrapping_sub(seq, m_prev_seq);
+            put_dod(m_writer, wrapping_sub(seq_delta, m_prev_seq_delta));
+            m_prev_seq_delta = seq_delta;
+        }
+        m_prev_ts = ts;
+        m_prev_value = bits;
+        m_prev_seq = seq;
+        m_count++;
+    }
+
+    size_t count() const { return m_count; }
+    // Encoded series, padded to a whole byte
+    const std::vector<uint8_t>& bytes() const { return m_writer.bytes(); }
+};
+
+class gorillaSeriesDecoder {
+private:
+    gorillaBitReader m_reader;
+    size_t m_remaining;
+    size_t m_index = 0;
+    int64_t m_ts = 0, m_delta = 0;
+    int64_t m_seq = 0, m_seq_delta = 1;
+    uint64_t m_value = 0;
+    int m_leading = 0, m_trailing = 0;
+
+public:
+    gorillaSeriesDecoder(const uint8_t* data, size_t size, size_t count)
+        : m_reader(data, size), m_remaining(count) {}
+
+    // False at the end of the series or on malformed input
+    bool next(int64_t& ts, double& value, int64_t& seq){
+        using namespace gorilla_detail;
+        if (m_remaining == 0) return false;
+        if (m_index == 0) {
+            uint64_t t, v, s;
+            if (!m_reader.read(64, t) || !m_reader.read(64, v) || !m_reader.read(64, s)) return false;
+            m_ts = static_cast<int64_t>(t);
+            m_value = v;
+            m_seq = static_cast<int64_t>(s);
+        } else {
+            int64_t dod;
+            if (!get_dod(m_reader, dod)) return false;
+            m_delta = wrapping_add(m_delta, dod);
+            m_ts = wrapping_add(m_ts, m_delta);
+
+            uint64_t control;
+            if (!m_reader.read(1, control)) return false;
+            if (control) {
+                if (!m_reader.read(1, control)) return false;
+                if (control) {
+                    uint64_t leading, meaningful;
+                    if (!m_reader.read(5, leading) || !m_reader.read(6, meaningful)) return false;
+                    if (meaningful == 0) meaningful = 64;
+                    if (leading + meaningful > 64) return false;
+                    m_leading = static_cast<int>(leading);
+                    m_trailing = 64 - m_leading - static_cast<int>(meaningful);
+                }
+                uint64_t x;
+                if (!m_reader.read(64 - m_leading - m_trailing, x)) return false;
+                m_value ^= x << m_trailing;
+            }
+
+            if (!get_dod(m_reader, dod)) return false;
+            m_seq_delta = wrapping_add(m_seq_delta, dod);
+            m_seq = wrapping_add(m_seq, m_seq_delta);
+        }
+        ts = m_ts;
+        value = bits_double(m_value);
+        seq = m_seq;
+        m_index++;
+        m_remaining--;
+        return true;
+    }
+};
+
+// Several series in one block, each tagged with a caller-chosen id (e.g. a frame's
+// sensor index). Block layout: varint series count, then per series varint id,
+// varint reading count, varint byte length and the series bytes.
+class gorillaBlockEncoder {
+private:
+    std::vector<gorillaSeriesEncoder> m_series;   // indexed by id, reused across blocks
+    std::vector<uint32_t> m_used;
+
+public:
+    void append(uint32_t id, int64_t ts, double value, int64_t seq){
+        if (id >= m_series.size()) m_series.resize(id + 1);
+        if (m_series[id].count() == 0) m_used.push_back(id);
+        m_series[id].append(ts, value, seq);
+    }
+
+    bool empty() const { return m_used.empty(); }
+
+    // Appends the block to out (any byte container) and starts a new one
+    template <typename Bytes>
+    void finish(Bytes& out){
+        gorilla_put_varint(out, m_used.size());
+        for (uint32_t id : m_used) {
+            gorillaSeriesEncoder& series = m_series[id];
+            gorilla_put_varint(out, id);
+            gorilla_put_varint(out, series.count());
+            gorilla_put_varint(out, series.bytes().size());
+            out.insert(out.end(), series.bytes().begin(), series.bytes().end());
+            series.reset();
+        }
+        m_used.clear();
+    }
+};
+
+// Calls emit(id, ts, value, seq) for every reading, series by series. Returns false
+// on malformed input; readings emitted before the error are not rolled back.
+template <typename F>
+bool gorilla_decode_block(const uint8_t* data, size_t size, F&& emit){
+    const uint8_t* p = data;
+    const uint8_t* end = data + size;
+    uint64_t series_count;
+    if (!gorilla_get_varint(p, end, series_count)) return false;
+    for (uint64_t s = 0; s < series_count; ++s) {
+        uint64_t id, count, length;
+        if (!gorilla_get_varint(p, end, id) || !gorilla_get_varint(p, end, count) || !gorilla_get_varint(p, end, length)) return false;
+        if (length > static_cast<uint64_t>(end - p)) return false;
+        gorillaSeriesDecoder series(p, length, count);
+        int64_t ts, seq;
+        double value;
+        for (uint64_t i = 0; i < count; ++i) {
+            if (!series.next(ts, value, seq)) return false;
+            emit(static_cast<uint32_t>(id), ts, value, seq);
+        }
+        p += length;
+    }
+    return p == end;
+}
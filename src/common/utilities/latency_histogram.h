@@ -0,0 +1,147 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Percentiles of a latency histogram, in its recording unit
+struct latencySummary {
+    uint64_t count = 0;
+    int64_t p50 = 0;
+    int64_t p90 = 0;
+    int64_t p99 = 0;
+    int64_t p999 = 0;
+    int64_t max = 0;
+    double mean = 0.0;
+};
+
+// Log-linear (HDR-style) histogram of non-negative values in fixed memory. Each
+// power of two is split into SUB_BUCKETS linear buckets, so a percentile is
+// reported within 1/SUB_BUCKETS (~3%) above the true value; values below
+// SUB_BUCKETS are exact. record() is O(1) and histograms merge by adding counts.
+// Values of 2^MAX_EXPONENT and above share the last bucket; max stays exact.
+// Single writer.
+class latencyHistogram {
+public:
+    static constexpr unsigned SUB_BUCKET_BITS = 5;
+    static constexpr uint64_t SUB_BUCKETS = uint64_t(1) << SUB_BUCKET_BITS;
+    static constexpr unsigned MAX_EXPONENT = 32;
+    static constexpr size_t BUCKETS = (MAX_EXPONENT - SUB_BUCKET_BITS + 1) * SUB_BUCKETS;
+
+private:
+    std::array<uint64_t, BUCKETS> m_counts{};
+    uint64_t m_count = 0;
+    int64_t m_max = 0;
+    double m_sum = 0.0;
+
+    // Bucket b >= SUB_BUCKETS covers [(SUB_BUCKETS + b % SUB_BUCKETS) << s, +2^s), s = b / SUB_BUCKETS - 1
+    static int64_t bucket_upper(size_t b){
+        if (b < SUB_BUCKETS) return static_cast<int64_t>(b);
+        const unsigned shift = static_cast<unsigned>(b / SUB_BUCKETS - 1);
+        const uint64_t lower = (SUB_BUCKETS + b % SUB_BUCKETS) << shift;
+        return static_cast<int64_t>(lower + (uint64_t(1) << shift) - 1);
+    }
+
+    int64_t percentile(double q) const {
+        uint64_t rank = static_cast<uint64_t>(std::ceil(q * static_cast<double>(m_count)));
+        rank = std::max<uint64_t>(1, std::min(rank, m_count));
+        uint64_t seen = 0;
+        for (size_t b = 0; b < BUCKETS; ++b) {
+            seen += m_counts[b];
+            if (seen >= rank) return std::min(m_max, bucket_upper(b));
+        }
+        return m_max;
+    }
+
+public:
+    static size_t bucket_of(int64_t value){
+        const uint64_t v = value < 0 ? 0 : static_cast<uint64_t>(value);
+        if (v < SUB_BUCKETS) return static_cast<size_t>(v);
+        const unsigned exponent = 63u - static_cast<unsigned>(__builtin_clzll(v));
+        if (exponent >= MAX_EXPONENT) return BUCKETS - 1;
+        const unsigned shift = exponent - SUB_BUCKET_BITS;
+        return static_cast<size_t>((shift + 1) * SUB_BUCKETS + ((v >> shift) - SUB_BUCKETS));
+    }
+
+    // Negative values (clock skew between hosts) count as 0
+    void record(int64_t value){
+        if (value < 0) value = 0;
+        m_counts[bucket_of(value)]++;
+        m_count++;
+        m_sum += static_cast<double>(value);
+        m_max = std::max(m_max, value);
+    }
+
+    void merge(const latencyHistogram& other){
+        for (size_t b = 0; b < BUCKETS; ++b) m_counts[b] += other.m_counts[b];
+        m_count += other.m_count;
+        m_sum += other.m_sum;
+        m_max = std::max(m_max, other.m_max);
+    }
+
+    void reset(){
+        m_counts.fill(0);
+        m_count = 0;
+        m_max = 0;
+        m_sum = 0.0;
+    }
+
+    uint64_t count() const { return m_count; }
+
+    latencySummary summary() const {
+        latencySummary s;
+        s.count = m_count;
+        if (m_count == 0) return s;
+        s.p50 = percentile(0.50);
+        s.p90 = percentile(0.90);
+        s.p99 = percentile(0.99);
+        s.p999 = percentile(0.999);
+        s.max = m_max;
+        s.mean = m_sum / static_cast<double>(m_count);
+        return s;
+    }
+};
+
+// A latencyHistogram over a sliding window: the window is cut into SLICES, each
+// its own histogram, and a slice is cleared when time comes round to it again.
+// merge_into() covers the current, partly filled slice and the SLICES - 1 before
+// it, i.e. between (SLICES - 1) / SLICES of the window and all of it.
+class windowedLatencyHistogram {
+public:
+    static constexpr size_t SLICES = 10;
+
+private:
+    int64_t m_slice_ms;
+    std::vector<latencyHistogram> m_slices;
+    std::vector<int64_t> m_epochs;   // slice number each histogram holds, -1 when unused
+
+public:
+    explicit windowedLatencyHistogram(int64_t window_ms)
+        : m_slice_ms(std::max<int64_t>(1, window_ms / static_cast<int64_t>(SLICES))),
+          m_slices(SLICES),
+          m_epochs(SLICES, -1) {}
+
+    void record(int64_t value, int64_t now_ms){
+        const int64_t epoch = now_ms / m_slice_ms;
+        const size_t slot = static_cast<size_t>(epoch % static_cast<int64_t>(SLICES));
+        if (m_epochs[slot] != epoch) {
+            m_slices[slot].reset();
+            m_epochs[slot] = epoch;
+        }
+        m_slices[slot].record(value);
+    }
+
+    void merge_into(latencyHistogram& out, int64_t now_ms) const {
+        const int64_t epoch = now_ms / m_slice_ms;
+        for (size_t i = 0; i < SLICES; ++i) {
+            if (m_epochs[i] > epoch - static_cast<int64_t>(SLICES) && m_epochs[i] <= epoch) {
+                out.merge(m_slices[i]);
+            }
+        }
+    }
+
+    int64_t window_ms() const { return m_slice_ms * static_cast<int64_t>(SLICES); }
+};
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+// Little-endian loads and stores at unaligned addresses. On little-endian hosts
+// they are plain moves.
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+inline void le_store32(uint8_t* p, uint32_t v){ std::memcpy(p, &v, sizeof v); }
+inline void le_store64(uint8_t* p, uint64_t v){ std::memcpy(p, &v, sizeof v); }
+
+inline uint32_t le_load32(const uint8_t* p){
+    uint32_t v;
+    std::memcpy(&v, p, sizeof v);
+    return v;
+}
+
+inline uint64_t le_load64(const uint8_t* p){
+    uint64_t v;
+    std::memcpy(&v, p, sizeof v);
+    return v;
+}
+#else
+inline void le_store32(uint8_t* p, uint32_t v){
+    for (int i = 0; i < 4; ++i) p[i] = static_cast<uint8_t>(v >> (8 * i));
+}
+
+inline void le_store64(uint8_t* p, uint64_t v){
+    for (int i = 0; i < 8; ++i) p[i] = static_cast<uint8_t>(v >> (8 * i));
+}
+
+inline uint32_t le_load32(const uint8_t* p){
+    uint32_t v = 0;
+    for (int i = 0; i < 4; ++i) v |= uint32_t(p[i]) << (8 * i);
+    return v;
+}
+
+inline uint64_t le_load64(const uint8_t* p){
+    uint64_t v = 0;
+    for (int i = 0; i < 8; ++i) v |= uint64_t(p[i]) << (8 * i);
+    return v;
+}
+#endif
+
+template <typename To, typename From>
+inline To bit_cast_value(const From& from){
+    static_assert(sizeof(To) == sizeof(From), "bit_cast_value needs equal sizes");
+    To to;
+    std::memcpy(&to, &from, sizeof to);
+    return to;
+}
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "fast_random.h"
+#include "option_values.h"
+
+// Shape of the values a synthetic channel produces
+enum class valueShape {
+    Uniform,      // a .. b
+    Normal,       // mean a, stddev b
+    RandomWalk,   // starts at a, steps of at most +-b
+    Sine          // mean a, amplitude b, one period every c samples, plus noise of +-d
+};
+
+struct valueDistribution {
+    valueShape shape = valueShape::Uniform;
+    double a = 0.0;
+    double b = 1.0;
+    double c = 100.0;
+    double d = 0.0;
+};
+
+// Reads "normal:<mean>:<stddev>", "uniform:<lo>:<hi>", "walk:<start>:<step>" or
+// "sine:<mean>:<amplitude>:<period>:<noise>". Returns false on anything else.
+inline bool parse_value_distribution(const std::string& text, valueDistribution& dist){
+    std::vector<std::string> fields;
+    size_t begin = 0;
+    while (true) {
+        const size_t colon = text.find(':', begin);
+        fields.push_back(text.substr(begin, colon - begin));
+        if (colon == std::string::npos) break;
+        begin = colon + 1;
+    }
+
+    valueDistribution parsed;
+    size_t expected = 3;
+    if (fields[0] == "normal") parsed.shape = valueShape::Normal;
+    else if (fields[0] == "uniform") parsed.shape = valueShape::Uniform;
+    else if (fields[0] == "walk") parsed.shape = valueShape::RandomWalk;
+    else if (fields[0] == "sine") { parsed.shape = valueShape::Sine; expected = 5; }
+    else return false;
+    if (fields.size() != expected) return false;
+
+    if (!parse_finite(fields[1].c_str(), parsed.a)) return false;
+    switch (parsed.shape) {
+        case valueShape::Uniform:
+            if (!parse_finite(fields[2].c_str(), parsed.b) || parsed.b < parsed.a) return false;
+            break;
+        case valueShape::Normal:
+        case valueShape::RandomWalk:
+            if (!parse_non_negative(fields[2].c_str(), parsed.b)) return false;
+            break;
+        case valueShape::Sine:
+            if (!parse_non_negative(fields[2].c_str(), parsed.b)
+                || !parse_non_negative(fields[3].c_str(), parsed.c)
+                || !parse_non_negative(fields[4].c_str(), parsed.d)) return false;
+            break;
+    }
+    dist = parsed;
+    return true;
+}
+
+// Produces reading values in batches for capacity testing. Random numbers come
+// from a vectorized xoshiro batch, then the distribution is applied per batch.
+// One generator per thread; it holds no shared state.
+class loadGenerator {
+private:
+    static constexpr double TWO_PI = 6.283185307179586;
+
+    valueDistribution m_dist;
+    xoshiroBatch m_rng;
+    std::vector<double> m_unit;
+    double m_walk;
+    uint64_t m_phase = 0;
+
+public:
+    explicit loadGenerator(valueDistribution dist = {}, uint64_t seed = 0x5eed)
+        : m_dist(dist), m_rng(seed), m_walk(dist.a) {}
+
+    // Writes n values to out[0..n)
+    void generate(double* out, size_t n){
+        m_unit.resize(n + 1);
+        m_rng.fill_unit(m_unit.data(), n + 1);
+        const double a = m_dist.a, b = m_dist.b;
+        switch (m_dist.shape) {
+            case valueShape::Uniform:
+                for (size_t i = 0; i < n; ++i) out[i] = a + (b - a) * m_unit[i];
+                break;
+            case valueShape::Normal:
+                // Box-Muller on pairs; 1 - u keeps the log argument in (0, 1]
+                for (size_t i = 0; i < n; i += 2) {
+                    const double r = b * std::sqrt(-2.0 * std::log(1.0 - m_unit[i]));
+                    const double theta = TWO_PI * m_unit[i + 1];
+                    out[i] = a + r * std::cos(theta);
+                    if (i + 1 < n) out[i + 1] = a + r * std::sin(theta);
+                }
+                break;
+            case valueShape::RandomWalk:
+                for (size_t i = 0; i < n; ++i) {
+                    m_walk += b * (2.0 * m_unit[i] - 1.0);
+                    out[i] = m_walk;
+                }
+                break;
+            case valueShape::Sine: {
+                const double step = m_dist.c > 0 ? TWO_PI / m_dist.c : 0.0;
+                for (size_t i = 0; i < n; ++i) {
+                    out[i] = a + b * std::sin(step * static_cast<double>(m_phase + i))
+                               + m_dist.d * (2.0 * m_unit[i] - 1.0);
+                }
+                m_phase += n;
+                break;
+            }
+        }
+    }
+
+    void generate(std::vector<double>& out){
+        generate(out.data(), out.size());
+    }
+};
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cerrno>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Read-only memory mapping of a whole file. The pages are only faulted in as the
+// view is read, so large captures cost no up-front copy. Throws std::system_error
+// when the file cannot be opened or mapped.
+class mappedFile {
+private:
+    void* m_data = nullptr;
+    size_t m_size = 0;
+
+    void release(){
+        if (m_data) munmap(m_data, m_size);
+        m_data = nullptr;
+        m_size = 0;
+    }
+
+public:
+    explicit mappedFile(const std::string& path){
+        const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) throw std::system_error(errno, std::generic_category(), "open " + path);
+        struct stat st;
+        if (fstat(fd, &st) != 0) {
+            const int err = errno;
+            ::close(fd);
+            throw std::system_error(err, std::generic_category(), "stat " + path);
+        }
+        m_size = static_cast<size_t>(st.st_size);
+        if (m_size > 0) {
+            m_data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (m_data == MAP_FAILED) {
+                const int err = errno;
+                m_data = nullptr;
+                ::close(fd);
+                throw std::system_error(err, std::generic_category(), "mmap " + path);
+            }
+            // Replay reads front to back; let the kernel read ahead aggressively
+            madvise(m_data, m_size, MADV_SEQUENTIAL);
+        }
+        // The mapping stays valid after the descriptor is closed
+        ::close(fd);
+    }
+
+    ~mappedFile(){
+        release();
+    }
+
+    mappedFile(const mappedFile&) = delete;
+    mappedFile& operator=(const mappedFile&) = delete;
+
+    mappedFile(mappedFile&& other) noexcept
+        : m_data(std::exchange(other.m_data, nullptr)), m_size(std::exchange(other.m_size, 0)) {}
+
+    mappedFile& operator=(mappedFile&& other) noexcept {
+        if (this != &other) {
+            release();
+            m_data = std::exchange(other.m_data, nullptr);
+            m_size = std::exchange(other.m_size, 0);
+        }
+        return *this;
+    }
+
+    std::string_view view() const {
+        return std::string_view(static_cast<const char*>(m_data), m_size);
+    }
+
+    size_t size() const { return m_size; }
+};
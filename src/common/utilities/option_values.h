@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cerrno>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+
+// Numeric command line values. The whole argument must be a number in range;
+// anything else returns false so the caller can print its usage message instead
+// of throwing out of main().
+
+inline bool parse_count(const char* text, size_t& value){
+    const char* end = text + std::strlen(text);
+    size_t parsed = 0;
+    const auto [ptr, ec] = std::from_chars(text, end, parsed);
+    if (ec != std::errc() || ptr != end || ptr == text) return false;
+    value = parsed;
+    return true;
+}
+
+// Any finite value
+inline bool parse_finite(const char* text, double& value){
+    char* end = nullptr;
+    errno = 0;
+    const double parsed = std::strtod(text, &end);
+    if (end == text || *end != '\0' || errno == ERANGE || !std::isfinite(parsed)) return false;
+    value = parsed;
+    return true;
+}
+
+// Finite and not negative
+inline bool parse_non_negative(const char* text, double& value){
+    double parsed = 0.0;
+    if (!parse_finite(text, parsed) || parsed < 0.0) return false;
+    value = parsed;
+    return true;
+}
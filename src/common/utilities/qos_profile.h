@@ -0,0 +1,171 @@
+#pragma once
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// DDS QoS settings of one endpoint kind, by name. Publisher and subscriber build
+// every writer and reader from the same profile so the two ends always match.
+struct qosProfile {
+    std::string name;
+    bool reliable = true;
+    bool transient_local = false;
+    int32_t history_depth = 1;      // KeepLast depth, 0 keeps all
+    int64_t deadline_ms = 0;        // 0 = no deadline
+    int64_t latency_budget_ms = 0;  // 0 = no budget
+};
+
+// Named QoS profiles: the built-in ones, optionally overridden or extended from
+// an INI-style file (config/qos_profiles.ini):
+//   [profile-name]
+//   reliability = reliable | best-effort
+//   durability = volatile | transient-local
+//   history = <depth> | keep-all
+//   deadline_ms = <ms>
+//   latency_budget_ms = <ms>
+// A section starts from the built-in profile of that name, if any, else from the
+// qosProfile defaults. '#' and ';' start comments.
+class qosProfileSet {
+private:
+    std::vector<qosProfile> m_profiles;
+
+    static std::string_view trim(std::string_view s){
+        const size_t start = s.find_first_not_of(" \t\r");
+        if (start == std::string_view::npos) return {};
+        const size_t end = s.find_last_not_of(" \t\r");
+        return s.substr(start, end - start + 1);
+    }
+
+    template <typename V>
+    static bool parse_number(std::string_view text, V& out){
+        if (text.empty()) return false;
+        const auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), out);
+        return ec == std::errc() && ptr == text.data() + text.size() && out >= 0;
+    }
+
+    static bool apply(qosProfile& p, std::string_view key, std::string_view val){
+        if (key == "reliability") {
+            if (val != "reliable" && val != "best-effort") return false;
+            p.reliable = val == "reliable";
+            return true;
+        }
+        if (key == "durability") {
+            if (val != "volatile" && val != "transient-local") return false;
+            p.transient_local = val == "transient-local";
+            return true;
+        }
+        if (key == "history") {
+            if (val == "keep-all") {
+                p.history_depth = 0;
+                return true;
+            }
+            return parse_number(val, p.history_depth) && p.history_depth > 0;
+        }
+        if (key == "deadline_ms") return parse_number(val, p.deadline_ms);
+        if (key == "latency_budget_ms") return parse_number(val, p.latency_budget_ms);
+        return false;
+    }
+
+    qosProfile& find_or_add(std::string_view name){
+        for (qosProfile& p : m_profiles) {
+            if (p.name == name) return p;
+        }
+        m_profiles.push_back(qosProfile{});
+        m_profiles.back().name = std::string(name);
+        return m_profiles.back();
+    }
+
+public:
+    static constexpr const char* TELEMETRY_BEST_EFFORT = "telemetry-best-effort";
+    static constexpr const char* TELEMETRY_RELIABLE = "telemetry-reliable";
+    static constexpr const char* LATE_JOIN_SNAPSHOT = "late-join-snapshot";
+    static constexpr const char* CHANNEL_DICTIONARY = "channel-dictionary";
+
+    qosProfileSet(){
+        // Fire and forget: only the newest frame of each channel is worth anything
+        qosProfile& best_effort = find_or_add(TELEMETRY_BEST_EFFORT);
+        best_effort.reliable = false;
+        best_effort.history_depth = 1;
+        // Every frame delivered to readers that are up; nothing kept for later ones
+        qosProfile& reliable = find_or_add(TELEMETRY_RELIABLE);
+        reliable.history_depth = 10;
+        reliable.deadline_ms = 1000;
+        // Reliable, and late joiners get the last 10 frames of every channel
+        qosProfile& snapshot = find_or_add(LATE_JOIN_SNAPSHOT);
+        snapshot.transient_local = true;
+        snapshot.history_depth = 10;
+        snapshot.deadline_ms = 1000;
+        // The id -> name table: one durable sample
+        qosProfile& dictionary = find_or_add(CHANNEL_DICTIONARY);
+        dictionary.transient_local = true;
+        dictionary.history_depth = 1;
+    }
+
+    // Returns false and describes the first bad line in error; profiles parsed
+    // before it are kept
+    bool parse(std::string_view text, std::string& error){
+        qosProfile* current = nullptr;
+        size_t line_no = 0;
+        while (!text.empty()) {
+            const size_t eol = text.find('\n');
+            std::string_view line = text.substr(0, eol);
+            text.remove_prefix(eol == std::string_view::npos ? text.size() : eol + 1);
+            line_no++;
+
+            const size_t comment = line.find_first_of("#;");
+            if (comment != std::string_view::npos) line = line.substr(0, comment);
+            line = trim(line);
+            if (line.empty()) continue;
+
+            if (line.front() == '[') {
+                const std::string_view name = trim(line.substr(1, line.size() - 1 - (line.back() == ']')));
+                if (line.back() != ']' || name.empty()) {
+                    error = "line " + std::to_string(line_no) + ": bad section header";
+                    return false;
+                }
+                current = &find_or_add(name);
+                continue;
+            }
+            const size_t eq = line.find('=');
+            if (!current || eq == std::string_view::npos) {
+                error = "line " + std::to_string(line_no) + ": expected key = value inside a [profile]";
+                return false;
+            }
+            const std::string_view key = trim(line.substr(0, eq));
+            if (!apply(*current, key, trim(line.substr(eq + 1)))) {
+                error = "line " + std::to_string(line_no) + ": bad value for '" + std::string(key) + "'";
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool load_file(const std::string& path, std::string& error){
+        std::ifstream file(path);
+        if (!file) {
+            error = "cannot open " + path;
+            return false;
+        }
+        std::ostringstream text;
+        text << file.rdbuf();
+        if (!parse(text.str(), error)) {
+            error = path + " " + error;
+            return false;
+        }
+        return true;
+    }
+
+    const qosProfile* find(std::string_view name) const {
+        for (const qosProfile& p : m_profiles) {
+            if (p.name == name) return &p;
+        }
+        return nullptr;
+    }
+
+    const std::vector<qosProfile>& profiles() const { return m_profiles; }
+};
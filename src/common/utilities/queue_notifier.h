@@ -0,0 +1,58 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+// Wakeup channel shared by several queues so one consumer can sleep until any of
+// them has data. Producers bump an epoch after every push; the mutex is only taken
+// when a consumer is actually waiting, so the common push path stays lock-free.
+class queueNotifier {
+private:
+    std::atomic<uint64_t> m_epoch{0};
+    std::atomic<uint32_t> m_waiters{0};
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+
+public:
+    uint64_t epoch() const {
+        return m_epoch.load();
+    }
+
+    void notify(){
+        m_epoch.fetch_add(1);
+        if (m_waiters.load() > 0) {
+            // Taking the lock orders this wakeup after the waiter's predicate check
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_cv.notify_all();
+        }
+    }
+
+    // Blocks until the epoch moves past seen_epoch or the timeout expires.
+    // Returns true when woken by a notify.
+    template <typename Rep, typename Period>
+    bool wait_for(uint64_t seen_epoch, const std::chrono::duration<Rep, Period>& timeout){
+        m_waiters.fetch_add(1);
+        bool woken;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            woken = m_cv.wait_for(lock, timeout, [&]{ return m_epoch.load() != seen_epoch; });
+        }
+        m_waiters.fetch_sub(1);
+        return woken;
+    }
+
+    template <typename Clock, typename Duration>
+    bool wait_until(uint64_t seen_epoch, const std::chrono::time_point<Clock, Duration>& deadline){
+        m_waiters.fetch_add(1);
+        bool woken;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            woken = m_cv.wait_until(lock, deadline, [&]{ return m_epoch.load() != seen_epoch; });
+        }
+        m_waiters.fetch_sub(1);
+        return woken;
+    }
+};
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+// What a bounded queue does with a push that finds it full
+enum class overflowPolicy {
+    Block,            // producer waits for space
+    DropOldest,       // evict the head to make room
+    DropNewest,       // reject the incoming item
+    OverwriteLatest   // replace the newest queued item with the same key, else drop oldest
+};
+
+constexpr size_t CACHE_LINE_SIZE = 64;
+
+inline int64_t queue_clock_ns(){
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()
+    ).count();
+}
+
+// Plain copy of the counters for reporting
+struct queueStatsSnapshot {
+    uint64_t pushed = 0;
+    uint64_t popped = 0;
+    uint64_t dropped = 0;
+    uint64_t high_water = 0;
+    int64_t dwell_max_ns = 0;
+    double dwell_avg_ns = 0.0;
+};
+
+// Counters updated by the queue itself. Writers use relaxed atomics; readers get
+// a consistent-enough view for dashboards and logs.
+class queueStats {
+private:
+    std::atomic<uint64_t> m_pushed{0};
+    std::atomic<uint64_t> m_popped{0};
+    std::atomic<uint64_t> m_dropped{0};
+    std::atomic<uint64_t> m_high_water{0};
+    std::atomic<int64_t> m_dwell_total_ns{0};
+    std::atomic<int64_t> m_dwell_max_ns{0};
+
+    template <typename V>
+    static void store_max(std::atomic<V>& target, typename std::atomic<V>::value_type value){
+        V current = target.load(std::memory_order_relaxed);
+        while (value > current && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+    }
+
+public:
+    void on_push(uint64_t count = 1){
+        m_pushed.fetch_add(count, std::memory_order_relaxed);
+    }
+
+    void observe_depth(uint64_t depth){
+        store_max(m_high_water, depth);
+    }
+
+    void on_drop(uint64_t count = 1){
+        m_dropped.fetch_add(count, std::memory_order_relaxed);
+    }
+
+    void on_pop(int64_t dwell_ns){
+        m_popped.fetch_add(1, std::memory_order_relaxed);
+        m_dwell_total_ns.fetch_add(dwell_ns, std::memory_order_relaxed);
+        store_max(m_dwell_max_ns, dwell_ns);
+    }
+
+    queueStatsSnapshot snapshot() const {
+        queueStatsSnapshot s;
+        s.pushed = m_pushed.load(std::memory_order_relaxed);
+        s.popped = m_popped.load(std::memory_order_relaxed);
+        s.dropped = m_dropped.load(std::memory_order_relaxed);
+        s.high_water = m_high_water.load(std::memory_order_relaxed);
+        s.dwell_max_ns = m_dwell_max_ns.load(std::memory_order_relaxed);
+        if (s.popped > 0) {
+            s.dwell_avg_ns = static_cast<double>(m_dwell_total_ns.load(std::memory_order_relaxed)) / s.popped;
+        }
+        return s;
+    }
+};
+
+// Counters for a single-producer single-consumer queue. Each side owns its own
+// cache line and is the only writer of its counters, so an update is a relaxed
+// load and store rather than a read-modify-write the other side has to wait on.
+// Dwell time is sampled, one item in DWELL_SAMPLE, to keep clock reads off the
+// per-item path.
+class spscQueueStats {
+public:
+    static constexpr uint64_t DWELL_SAMPLE = 64;
+
+    // True for the queue positions whose dwell time is measured
+    static bool dwell_sampled(size_t position){
+        return position % DWELL_SAMPLE == 0;
+    }
+
+private:
+    struct alignas(CACHE_LINE_SIZE) producerSide {
+        std::atomic<uint64_t> pushed{0};
+        std::atomic<uint64_t> dropped{0};
+    };
+    struct alignas(CACHE_LINE_SIZE) consumerSide {
+        std::atomic<uint64_t> popped{0};
+        std::atomic<uint64_t> high_water{0};
+        std::atomic<uint64_t> dwell_samples{0};
+        std::atomic<int64_t> dwell_total_ns{0};
+        std::atomic<int64_t> dwell_max_ns{0};
+    };
+
+    producerSide m_producer;
+    consumerSide m_consumer;
+
+    template <typename V>
+    static void add(std::atomic<V>& counter, V n){
+        counter.store(counter.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+    }
+
+    template <typename V>
+    static void raise(std::atomic<V>& counter, V value){
+        if (value > counter.load(std::memory_order_relaxed)) counter.store(value, std::memory_order_relaxed);
+    }
+
+public:
+    // Producer side
+    void on_push(uint64_t count = 1){ add(m_producer.pushed, count); }
+    void on_drop(uint64_t count = 1){ add(m_producer.dropped, count); }
+
+    // Consumer side
+    void observe_depth(uint64_t depth){ raise(m_consumer.high_water, depth); }
+    void on_pop(uint64_t count = 1){ add(m_consumer.popped, count); }
+    void on_dwell(int64_t dwell_ns){
+        add<uint64_t>(m_consumer.dwell_samples, 1);
+        add(m_consumer.dwell_total_ns, dwell_ns);
+        raise(m_consumer.dwell_max_ns, dwell_ns);
+    }
+
+    queueStatsSnapshot snapshot() const {
+        queueStatsSnapshot s;
+        s.pushed = m_producer.pushed.load(std::memory_order_relaxed);
+        s.dropped = m_producer.dropped.load(std::memory_order_relaxed);
+        s.popped = m_consumer.popped.load(std::memory_order_relaxed);
+        s.high_water = m_consumer.high_water.load(std::memory_order_relaxed);
+        s.dwell_max_ns = m_consumer.dwell_max_ns.load(std::memory_order_relaxed);
+        const uint64_t samples = m_consumer.dwell_samples.load(std::memory_order_relaxed);
+        if (samples > 0) {
+            s.dwell_avg_ns = static_cast<double>(m_consumer.dwell_total_ns.load(std::memory_order_relaxed)) / samples;
+        }
+        return s;
+    }
+};
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+// One recorded sample. sensor_id points into the text being read.
+struct replayRecord {
+    std::string_view sensor_id;
+    double value = 0.0;
+    int64_t timestamp = 0;
+    uint32_t sequence_num = 0;
+};
+
+// Pulls sample records out of recorded logs without copying the text. Understands
+// the spdlog lines written by the publisher and subscriber
+//   [..] [..] [..] [info] PUB sensor=<id> value=<v> ts=<ms> [rs=<ms>] seq=<n>
+// and the legacy CSV log lines "<id> <value> <ts> <seq>". Anything else is
+// skipped and counted.
+class replayReader {
+private:
+    std::string_view m_text;
+    size_t m_pos = 0;
+    uint64_t m_skipped = 0;
+
+    static std::string_view next_token(std::string_view& line){
+        size_t start = line.find_first_not_of(" \t\r");
+        if (start == std::string_view::npos) {
+            line = {};
+            return {};
+        }
+        size_t end = line.find_first_of(" \t\r", start);
+        if (end == std::string_view::npos) end = line.size();
+        std::string_view token = line.substr(start, end - start);
+        line.remove_prefix(end);
+        return token;
+    }
+
+    template <typename V>
+    static bool parse_number(std::string_view text, V& out){
+        if (text.empty()) return false;
+        const auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), out);
+        return ec == std::errc() && ptr == text.data() + text.size();
+    }
+
+    static bool parse_pub_line(std::string_view fields, replayRecord& rec){
+        bool has_sensor = false, has_value = false, has_ts = false, has_seq = false;
+        for (std::string_view token = next_token(fields); !token.empty(); token = next_token(fields)) {
+            const size_t eq = token.find('=');
+            if (eq == std::string_view::npos) return false;
+            const std::string_view key = token.substr(0, eq);
+            const std::string_view val = token.substr(eq + 1);
+            if (key == "sensor") { rec.sensor_id = val; has_sensor = !val.empty(); }
+            else if (key == "value") has_value = parse_number(val, rec.value);
+            else if (key == "ts") has_ts = parse_number(val, rec.timestamp);
+            else if (key == "seq") has_seq = parse_number(val, rec.sequence_num);
+        }
+        return has_sensor && has_value && has_ts && has_seq;
+    }
+
+    static bool parse_csv_line(std::string_view line, replayRecord& rec){
+        rec.sensor_id = next_token(line);
+        return !rec.sensor_id.empty()
+            && parse_number(next_token(line), rec.value)
+            && parse_number(next_token(line), rec.timestamp)
+            && parse_number(next_token(line), rec.sequence_num)
+            && next_token(line).empty();
+    }
+
+public:
+    explicit replayReader(std::string_view text) : m_text(text) {}
+
+    // Advances to the next record; false at the end of the text
+    bool next(replayRecord& rec){
+        while (m_pos < m_text.size()) {
+            size_t end = m_text.find('\n', m_pos);
+            if (end == std::string_view::npos) end = m_text.size();
+            const std::string_view line = m_text.substr(m_pos, end - m_pos);
+            m_pos = end + 1;
+            if (line.find_first_not_of(" \t\r") == std::string_view::npos) continue;
+
+            const size_t pub = line.find("PUB ");
+            const bool parsed = pub != std::string_view::npos
+                ? parse_pub_line(line.substr(pub + 4), rec)
+                : (line.front() != '[' && parse_csv_line(line, rec));
+            if (parsed) return true;
+            m_skipped++;
+        }
+        return false;
+    }
+
+    void rewind(){
+        m_pos = 0;
+        m_skipped = 0;
+    }
+
+    uint64_t skipped() const { return m_skipped; }
+};
@@ -1,19 +1,176 @@
+#pragma once
+
 #include <iostream>
 #include <atomic>
 #include <mutex>
-#include <queue>
+#include <deque>
 #include <optional>
+#include <chrono>
+#include <condition_variable>
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <vector>
+#include <utility>
+#include "queue_notifier.h"
+#include "queue_stats.h"
 
 template <typename T>
 class safeQueue {
 private:
-    std::queue<T> m_queue;
+    struct entry {
+        T item;
+        int64_t enqueued_ns;
+
+        // Builds the item in place from the arguments
+        template <typename... Args>
+        explicit entry(int64_t enqueued, Args&&... args)
+            : item(std::forward<Args>(args)...), enqueued_ns(enqueued) {}
+    };
+
+    std::deque<entry> m_queue;
     mutable std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::condition_variable m_not_full;
+    bool m_closed = false;
+    queueNotifier* m_notifier = nullptr;
+
+    size_t m_capacity;
+    overflowPolicy m_policy;
+    std::function<bool(const T&, const T&)> m_same_key;
+    queueStats m_stats;
+
+    void signal_consumers(){
+        m_cv.notify_one();
+        if (m_notifier) m_notifier->notify();
+    }
+
+    // Caller holds the lock. Returns false when the item has to be dropped.
+    bool make_room(std::unique_lock<std::mutex>& lock, const T& item){
+        if (m_closed) return false;
+        if (m_queue.size() < m_capacity) return true;
+        switch (m_policy) {
+            case overflowPolicy::Block:
+                // A bulk push may be the one that filled the queue; its consumers
+                // have to hear about it before the producer waits on them
+                m_cv.notify_all();
+                if (m_notifier) m_notifier->notify();
+                m_not_full.wait(lock, [this]{ return m_queue.size() < m_capacity || m_closed; });
+                return !m_closed;
+            case overflowPolicy::DropNewest:
+                m_stats.on_drop();
+                return false;
+            case overflowPolicy::OverwriteLatest:
+                if (m_same_key) {
+                    auto it = std::find_if(m_queue.rbegin(), m_queue.rend(),
+                                           [&](const entry& e){ return m_same_key(e.item, item); });
+                    if (it != m_queue.rend()) {
+                        m_queue.erase(std::next(it).base());
+                        m_stats.on_drop();
+                        return true;
+                    }
+                }
+                [[fallthrough]];
+            case overflowPolicy::DropOldest:
+                m_queue.pop_front();
+                m_stats.on_drop();
+                return true;
+        }
+        return true;
+    }
+
+    T take_front(){
+        entry e = std::move(m_queue.front());
+        m_queue.pop_front();
+        m_stats.on_pop(queue_clock_ns() - e.enqueued_ns);
+        m_not_full.notify_one();
+        return std::move(e.item);
+    }
 
 public:
-    void push_in_queue(const T& item){
+    // capacity 0 keeps the queue unbounded
+    explicit safeQueue(size_t capacity = 0, overflowPolicy policy = overflowPolicy::Block)
+        : m_capacity(capacity == 0 ? std::numeric_limits<size_t>::max() : capacity), m_policy(policy) {}
+
+    // Optional shared notifier, set before producers start
+    void attach_notifier(queueNotifier* notifier){
+        m_notifier = notifier;
+    }
+
+    // Tells OverwriteLatest which queued items share a key with an incoming one
+    void set_key_matcher(std::function<bool(const T&, const T&)> same_key){
         std::lock_guard<std::mutex> lock(m_mutex);
-        m_queue.push(item);
+        m_same_key = std::move(same_key);
+    }
+
+    // Returns false when the item was dropped by the overflow policy or the queue is closed
+    bool push_in_queue(const T& item){
+        return emplace(item);
+    }
+
+    bool push_in_queue(T&& item){
+        return emplace(std::move(item));
+    }
+
+    // Constructs the item directly inside the queue's storage. When the queue is
+    // full the item is built first, since the overflow policy may need to see it.
+    template <typename... Args>
+    bool emplace(Args&&... args){
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            if (m_closed) return false;
+            if (m_queue.size() >= m_capacity) {
+                // Policies that look at the incoming item need it built first
+                T item(std::forward<Args>(args)...);
+                if (!make_room(lock, item)) return false;
+                m_queue.emplace_back(queue_clock_ns(), std::move(item));
+            } else {
+                m_queue.emplace_back(queue_clock_ns(), std::forward<Args>(args)...);
+            }
+            m_stats.on_push();
+            m_stats.observe_depth(m_queue.size());
+        }
+        signal_consumers();
+        return true;
+    }
+
+    // Pushes a whole batch under one lock acquisition. Returns the number accepted.
+    template <typename Range>
+    size_t push_bulk(const Range& items){
+        size_t accepted = 0;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            int64_t now = queue_clock_ns();
+            for (const auto& item : items) {
+                const bool full = m_queue.size() >= m_capacity;
+                if (!make_room(lock, item)) continue;
+                // A Block wait can be long; what follows is stamped from its end
+                if (full) now = queue_clock_ns();
+                m_queue.emplace_back(now, item);
+                m_stats.on_push();
+                m_stats.observe_depth(m_queue.size());
+                accepted++;
+            }
+        }
+        m_cv.notify_all();
+        if (m_notifier) m_notifier->notify();
+        return accepted;
+    }
+
+    // Moves up to max_n items onto the back of out under one lock acquisition.
+    // Returns the number of items moved.
+    size_t drain_into(std::vector<T>& out, size_t max_n = std::numeric_limits<size_t>::max()){
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stats.observe_depth(m_queue.size());
+        const size_t n = std::min(max_n, m_queue.size());
+        const int64_t now = queue_clock_ns();
+        for (size_t i = 0; i < n; ++i) {
+            m_stats.on_pop(now - m_queue.front().enqueued_ns);
+            out.push_back(std::move(m_queue.front().item));
+            m_queue.pop_front();
+        }
+        if (n > 0) m_not_full.notify_all();
+        return n;
     }
 
     std::optional<T> pop_from_queue(){
@@ -21,25 +178,61 @@ public:
         if(m_queue.empty()){
             return std::nullopt;
         }
-        T op = m_queue.front();
-        m_queue.pop();
-        return op;
+        return take_front();
+    }
+
+    // Blocks until an item is available. Returns nullopt once the queue is
+    // closed and drained.
+    std::optional<T> pop(){
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv.wait(lock, [this]{ return !m_queue.empty() || m_closed; });
+        if(m_queue.empty()){
+            return std::nullopt;
+        }
+        return take_front();
+    }
+
+    // Blocks for at most timeout. Returns nullopt on timeout or close.
+    template <typename Rep, typename Period>
+    std::optional<T> pop_for(const std::chrono::duration<Rep, Period>& timeout){
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if(!m_cv.wait_for(lock, timeout, [this]{ return !m_queue.empty() || m_closed; })){
+            return std::nullopt;
+        }
+        if(m_queue.empty()){
+            return std::nullopt;
+        }
+        return take_front();
+    }
+
+    // Wakes every blocked consumer and producer; pop() keeps returning queued
+    // items until empty
+    void close(){
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_closed = true;
+        }
+        m_cv.notify_all();
+        m_not_full.notify_all();
+        if (m_notifier) m_notifier->notify();
+    }
+
+    bool closed() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_closed;
     }
 
     void printQueue() {
         std::lock_guard<std::mutex> lock(m_mutex);
-        std::queue<T> temp = m_queue;
 
-        if (temp.empty()) {
+        if (m_queue.empty()) {
             std::cout << "Queue is empty\n";
             return;
         }
 
         std::cout << "Queue elements: ";
-        while (!temp.empty()) {
-            auto d = temp.front();
-            std::cout << d.value << " ";
-            temp.pop();
+        for (const auto& e : m_queue) {
+            std::cout << e.item.value << " ";
         }
         std::cout << std::endl;
     }
@@ -47,11 +240,10 @@ public:
     bool try_pop(T& result) {
         std::lock_guard<std::mutex> lock(m_mutex);
         if (m_queue.empty()) return false;
-        result = m_queue.front();
-        m_queue.pop();
+        result = take_front();
         return true;
     }
-    
+
     bool empty() const {
         std::lock_guard<std::mutex> lock(m_mutex);
         return m_queue.empty();
@@ -62,4 +254,12 @@ public:
         return m_queue.size();
     }
 
+    size_t capacity() const {
+        return m_capacity;
+    }
+
+    queueStatsSnapshot stats() const {
+        return m_stats.snapshot();
+    }
+
 };
@@ -0,0 +1,238 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "timer_wheel.h"
+
+inline int64_t scheduler_clock_ns(){
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()
+    ).count();
+}
+
+// Plain copy of a jitter histogram for reporting
+struct jitterSnapshot {
+    uint64_t count = 0;
+    int64_t max_ns = 0;
+    int64_t p50_ns = 0;
+    int64_t p99_ns = 0;
+};
+
+// How late each sample fired, in power-of-two microsecond buckets. Written by one
+// scheduler worker, readable from any thread.
+class jitterHistogram {
+public:
+    static constexpr size_t BUCKETS = 32;   // bucket b holds [2^(b-1), 2^b) us, bucket 0 < 1 us
+
+private:
+    std::array<std::atomic<uint64_t>, BUCKETS> m_counts{};
+    std::atomic<int64_t> m_max_ns{0};
+
+    static int64_t bucket_upper_ns(size_t b){
+        return (int64_t(1) << b) * 1000;
+    }
+
+    static int64_t percentile(const std::array<uint64_t, BUCKETS>& counts, uint64_t total, double q){
+        const uint64_t rank = static_cast<uint64_t>(q * total);
+        uint64_t seen = 0;
+        for (size_t b = 0; b < BUCKETS; ++b) {
+            seen += counts[b];
+            if (seen > rank) return bucket_upper_ns(b);
+        }
+        return bucket_upper_ns(BUCKETS - 1);
+    }
+
+public:
+    void record(int64_t late_ns){
+        if (late_ns < 0) late_ns = 0;
+        const uint64_t us = static_cast<uint64_t>(late_ns / 1000);
+        size_t b = 0;
+        while (b + 1 < BUCKETS && (uint64_t(1) << b) <= us) b++;
+        m_counts[b].fetch_add(1, std::memory_order_relaxed);
+        if (late_ns > m_max_ns.load(std::memory_order_relaxed)) m_max_ns.store(late_ns, std::memory_order_relaxed);
+    }
+
+    // Percentiles are reported as the upper bound of their bucket
+    jitterSnapshot snapshot() const {
+        std::array<uint64_t, BUCKETS> counts;
+        jitterSnapshot s;
+        for (size_t b = 0; b < BUCKETS; ++b) {
+            counts[b] = m_counts[b].load(std::memory_order_relaxed);
+            s.count += counts[b];
+        }
+        s.max_ns = m_max_ns.load(std::memory_order_relaxed);
+        if (s.count > 0) {
+            s.p50_ns = std::min(s.max_ns, percentile(counts, s.count, 0.50));
+            s.p99_ns = std::min(s.max_ns, percentile(counts, s.count, 0.99));
+        }
+        return s;
+    }
+};
+
+// Fires per-channel sample callbacks at absolute deadlines (start + k * period) on
+// a small pool of workers, each driving its own timer wheel. A channel always runs
+// on the same worker, so a callback may be the single producer of an SPSC link.
+// Deadlines never drift with callback cost; when a worker falls a whole period
+// behind the missed samples are skipped and counted rather than fired in a burst.
+class sensorScheduler {
+public:
+    // Called with the deadline the sample was due at; return false to stop the channel
+    using sample_fn = std::function<bool(int64_t deadline_ns)>;
+
+    struct channelStats {
+        uint64_t fired = 0;
+        uint64_t missed = 0;
+        jitterSnapshot jitter;
+    };
+
+private:
+    struct channel {
+        int64_t period_ns;
+        int64_t phase_ns;
+        int64_t deadline_ns = 0;
+        sample_fn fn;
+        size_t worker;
+        std::atomic<uint64_t> fired{0};
+        std::atomic<uint64_t> missed{0};
+        jitterHistogram jitter;
+
+        channel(int64_t period, int64_t phase, sample_fn f, size_t w)
+            : period_ns(period), phase_ns(phase), fn(std::move(f)), worker(w) {}
+    };
+
+    struct worker {
+        std::vector<size_t> channels;
+        std::atomic<uint64_t> wakeups{0};
+        std::thread thread;
+    };
+
+    int64_t m_tick_ns;
+    std::vector<std::unique_ptr<channel>> m_channels;
+    std::vector<std::unique_ptr<worker>> m_workers;
+    std::atomic<bool> m_stopping{false};
+    // Workers sleep on this until their next due tick; stop() wakes them early.
+    // Channels are fixed before start(), so nothing else needs to.
+    std::mutex m_wake_mutex;
+    std::condition_variable m_wake;
+    bool m_running = false;
+
+    uint64_t tick_at_or_after(int64_t ns) const {
+        return static_cast<uint64_t>((ns + m_tick_ns - 1) / m_tick_ns);
+    }
+
+    void run(size_t worker_id, int64_t start_ns){
+        timerWheel<size_t> wheel(static_cast<uint64_t>(start_ns / m_tick_ns));
+        for (size_t id : m_workers[worker_id]->channels) {
+            channel& c = *m_channels[id];
+            c.deadline_ns = start_ns + c.phase_ns;
+            wheel.schedule(id, tick_at_or_after(c.deadline_ns));
+        }
+
+        auto fire = [&](size_t id){
+            channel& c = *m_channels[id];
+            const int64_t now_ns = scheduler_clock_ns();
+            c.jitter.record(now_ns - c.deadline_ns);
+            c.fired.fetch_add(1, std::memory_order_relaxed);
+            if (!c.fn(c.deadline_ns)) return;
+
+            c.deadline_ns += c.period_ns;
+            if (c.deadline_ns <= now_ns - c.period_ns) {
+                const int64_t behind = (now_ns - c.deadline_ns) / c.period_ns;
+                c.missed.fetch_add(static_cast<uint64_t>(behind), std::memory_order_relaxed);
+                c.deadline_ns += behind * c.period_ns;
+            }
+            wheel.schedule(id, tick_at_or_after(c.deadline_ns));
+        };
+
+        while (!m_stopping.load(std::memory_order_acquire)) {
+            wheel.advance(static_cast<uint64_t>(scheduler_clock_ns() / m_tick_ns), fire);
+            if (wheel.size() == 0) break;
+            // Absolute wakeups on the next due tick keep the tick grid fixed however
+            // long the callbacks took, without waking on the ticks in between
+            const auto next_due = std::chrono::steady_clock::time_point(
+                std::chrono::nanoseconds(static_cast<int64_t>(wheel.next_due()) * m_tick_ns));
+            std::unique_lock<std::mutex> lock(m_wake_mutex);
+            m_wake.wait_until(lock, next_due, [this]{ return m_stopping.load(std::memory_order_acquire); });
+            m_workers[worker_id]->wakeups.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+public:
+    // tick_ns is the scheduling resolution; deadlines are rounded up to it
+    explicit sensorScheduler(size_t workers = 1, int64_t tick_ns = 1000000)
+        : m_tick_ns(tick_ns > 0 ? tick_ns : 1) {
+        if (workers == 0) workers = 1;
+        for (size_t i = 0; i < workers; ++i) {
+            m_workers.push_back(std::make_unique<worker>());
+        }
+    }
+
+    ~sensorScheduler(){
+        stop();
+    }
+
+    sensorScheduler(const sensorScheduler&) = delete;
+    sensorScheduler& operator=(const sensorScheduler&) = delete;
+
+    // Channels must be added before start(). The first sample is due phase_ns after
+    // start, later ones every period_ns; key picks the worker.
+    size_t add_channel(int64_t period_ns, sample_fn fn, uint64_t key, int64_t phase_ns = 0){
+        const size_t worker_id = key % m_workers.size();
+        m_channels.push_back(std::make_unique<channel>(std::max<int64_t>(period_ns, 1), phase_ns, std::move(fn), worker_id));
+        m_workers[worker_id]->channels.push_back(m_channels.size() - 1);
+        return m_channels.size() - 1;
+    }
+
+    void start(){
+        if (m_running) return;
+        m_running = true;
+        m_stopping.store(false);
+        const int64_t start_ns = scheduler_clock_ns();
+        for (size_t i = 0; i < m_workers.size(); ++i) {
+            m_workers[i]->thread = std::thread(&sensorScheduler::run, this, i, start_ns);
+        }
+    }
+
+    // Workers also exit on their own once every channel they own has stopped
+    void stop(){
+        if (!m_running) return;
+        {
+            std::lock_guard<std::mutex> lock(m_wake_mutex);
+            m_stopping.store(true, std::memory_order_release);
+        }
+        m_wake.notify_all();
+        for (auto& w : m_workers) {
+            if (w->thread.joinable()) w->thread.join();
+        }
+        m_running = false;
+    }
+
+    size_t worker_count() const { return m_workers.size(); }
+    size_t channel_count() const { return m_channels.size(); }
+
+    // Times the workers woke from sleep, summed over workers
+    uint64_t wakeups() const {
+        uint64_t total = 0;
+        for (const auto& w : m_workers) total += w->wakeups.load(std::memory_order_relaxed);
+        return total;
+    }
+
+    channelStats stats(size_t channel_id) const {
+        const channel& c = *m_channels[channel_id];
+        channelStats s;
+        s.fired = c.fired.load(std::memory_order_relaxed);
+        s.missed = c.missed.load(std::memory_order_relaxed);
+        s.jitter = c.jitter.snapshot();
+        return s;
+    }
+};
@@ -0,0 +1,228 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "queue_notifier.h"
+#include "spsc_ring_buffer.h"
+
+// Spreads per-channel work over a pool of worker threads. Every channel (one
+// sensor) has its own SPSC link and a home worker picked by its key. A channel
+// with pending data sits in exactly one worker's ready list and is drained by
+// one worker at a time, so per-channel order is preserved; idle workers steal
+// whole channels from the back of busy workers' lists.
+template <typename T>
+class shardedAggregator {
+public:
+    // Called on a worker thread with a batch of one channel's items, in order
+    using handler_t = std::function<void(size_t worker, size_t channel, std::vector<T>& batch)>;
+
+    struct workerStats {
+        uint64_t processed = 0;
+        uint64_t batches = 0;
+        uint64_t stolen = 0;
+    };
+
+private:
+    struct channel {
+        spscRingBuffer<T> link;
+        std::atomic<bool> scheduled{false};
+        size_t home;
+
+        channel(size_t capacity, size_t home_worker) : link(capacity), home(home_worker) {}
+    };
+
+    struct worker {
+        std::mutex mutex;
+        std::deque<size_t> ready;
+        std::vector<T> batch;
+        std::vector<T> spare;   // batch elements parked while batches are short
+        std::atomic<uint64_t> processed{0};
+        std::atomic<uint64_t> batches{0};
+        std::atomic<uint64_t> stolen{0};
+        std::thread thread;
+    };
+
+    handler_t m_handler;
+    size_t m_channel_capacity;
+    size_t m_max_batch;
+    std::vector<std::unique_ptr<channel>> m_channels;
+    std::vector<std::unique_ptr<worker>> m_workers;
+    queueNotifier m_notifier;
+    std::atomic<bool> m_stopping{false};
+    bool m_running = false;
+
+    void schedule(size_t channel_id, size_t worker_id){
+        {
+            std::lock_guard<std::mutex> lock(m_workers[worker_id]->mutex);
+            m_workers[worker_id]->ready.push_back(channel_id);
+        }
+        m_notifier.notify();
+    }
+
+    bool take_own(size_t worker_id, size_t& channel_id){
+        worker& w = *m_workers[worker_id];
+        std::lock_guard<std::mutex> lock(w.mutex);
+        if (w.ready.empty()) return false;
+        channel_id = w.ready.front();
+        w.ready.pop_front();
+        return true;
+    }
+
+    bool steal(size_t worker_id, size_t& channel_id){
+        for (size_t i = 1; i < m_workers.size(); ++i) {
+            worker& victim = *m_workers[(worker_id + i) % m_workers.size()];
+            std::unique_lock<std::mutex> lock(victim.mutex, std::try_to_lock);
+            if (!lock.owns_lock() || victim.ready.empty()) continue;
+            channel_id = victim.ready.back();
+            victim.ready.pop_back();
+            m_workers[worker_id]->stolen.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+        return false;
+    }
+
+    // Sizes the batch to n, parking surplus elements rather than destroying them
+    static void fit_batch(worker& w, size_t n){
+        while (w.batch.size() > n) {
+            w.spare.push_back(std::move(w.batch.back()));
+            w.batch.pop_back();
+        }
+        while (w.batch.size() < n) {
+            if (w.spare.empty()) {
+                w.batch.emplace_back();
+                continue;
+            }
+            w.batch.push_back(std::move(w.spare.back()));
+            w.spare.pop_back();
+        }
+    }
+
+    void process(size_t worker_id, size_t channel_id){
+        worker& w = *m_workers[worker_id];
+        channel& c = *m_channels[channel_id];
+
+        // Items are swapped out of the link rather than moved, so the storage the
+        // batch elements own goes back into the slots for submit_with to reuse
+        fit_batch(w, std::min(m_max_batch, c.link.size()));
+        fit_batch(w, c.link.swap_into(w.batch));
+        if (!w.batch.empty()) {
+            m_handler(worker_id, channel_id, w.batch);
+            w.processed.fetch_add(w.batch.size(), std::memory_order_relaxed);
+            w.batches.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // Release the channel; if more data raced in, put it back behind the others.
+        // Pairs with the fence in submit(): either this check sees the new item or
+        // the submitter sees the channel released and schedules it itself.
+        c.scheduled.store(false, std::memory_order_release);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (!c.link.empty() && !c.scheduled.exchange(true, std::memory_order_acq_rel)) {
+            schedule(channel_id, worker_id);
+        }
+    }
+
+    void run(size_t worker_id){
+        size_t channel_id = 0;
+        while (true) {
+            const uint64_t seen_epoch = m_notifier.epoch();
+            if (take_own(worker_id, channel_id) || steal(worker_id, channel_id)) {
+                process(worker_id, channel_id);
+                continue;
+            }
+            if (m_stopping.load(std::memory_order_acquire)) break;
+            m_notifier.wait_for(seen_epoch, std::chrono::milliseconds(50));
+        }
+    }
+
+public:
+    shardedAggregator(size_t workers, handler_t handler, size_t channel_capacity = 4096, size_t max_batch = 256)
+        : m_handler(std::move(handler)),
+          m_channel_capacity(channel_capacity),
+          m_max_batch(max_batch) {
+        if (workers == 0) workers = 1;
+        for (size_t i = 0; i < workers; ++i) {
+            m_workers.push_back(std::make_unique<worker>());
+            m_workers.back()->batch.reserve(m_max_batch);
+            m_workers.back()->spare.reserve(m_max_batch);
+        }
+    }
+
+    ~shardedAggregator(){
+        stop();
+    }
+
+    shardedAggregator(const shardedAggregator&) = delete;
+    shardedAggregator& operator=(const shardedAggregator&) = delete;
+
+    // Channels must be added before start(); key decides the home worker
+    size_t add_channel(uint64_t key){
+        m_channels.push_back(std::make_unique<channel>(m_channel_capacity, key % m_workers.size()));
+        return m_channels.size() - 1;
+    }
+
+    void start(){
+        if (m_running) return;
+        m_running = true;
+        m_stopping.store(false);
+        for (size_t i = 0; i < m_workers.size(); ++i) {
+            m_workers[i]->thread = std::thread(&shardedAggregator::run, this, i);
+        }
+    }
+
+    // Lets the workers finish every submitted item, then joins them
+    void stop(){
+        if (!m_running) return;
+        m_stopping.store(true, std::memory_order_release);
+        m_notifier.notify();
+        for (auto& w : m_workers) {
+            if (w->thread.joinable()) w->thread.join();
+        }
+        m_running = false;
+    }
+
+    // Only one thread may submit to a given channel. Returns false when the
+    // channel link is full; the item is left untouched so the caller can retry
+    // (each rejected attempt shows up as a drop in channel_stats).
+    bool submit(size_t channel_id, T&& item){
+        return submit_with(channel_id, [&](T& slot){ slot = std::move(item); });
+    }
+
+    // Like submit, but fill(T&) writes the item straight into the link slot and can
+    // reuse the storage the slot still owns (see spscRingBuffer::push_with)
+    template <typename Fill>
+    bool submit_with(size_t channel_id, Fill&& fill){
+        channel& c = *m_channels[channel_id];
+        if (!c.link.push_with(std::forward<Fill>(fill))) return false;
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (!c.scheduled.exchange(true, std::memory_order_acq_rel)) {
+            schedule(channel_id, c.home);
+        }
+        return true;
+    }
+
+    size_t worker_count() const { return m_workers.size(); }
+    size_t channel_count() const { return m_channels.size(); }
+
+    workerStats stats(size_t worker_id) const {
+        const worker& w = *m_workers[worker_id];
+        workerStats s;
+        s.processed = w.processed.load(std::memory_order_relaxed);
+        s.batches = w.batches.load(std::memory_order_relaxed);
+        s.stolen = w.stolen.load(std::memory_order_relaxed);
+        return s;
+    }
+
+    queueStatsSnapshot channel_stats(size_t channel_id) const {
+        return m_channels[channel_id]->link.stats();
+    }
+};
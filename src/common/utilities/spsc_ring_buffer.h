@@ -0,0 +1,226 @@
+#pragma once
+
+#include <atomic>
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <utility>
+#include <vector>
+#include "queue_notifier.h"
+#include "queue_stats.h"
+
+// Bounded lock-free queue for exactly one producer thread and one consumer thread.
+// Same push/try_pop surface as safeQueue, but storage is allocated once up front
+// and a full buffer rejects the push instead of growing (overflowPolicy::DropNewest;
+// the other policies need the producer to touch the head and are safeQueue-only).
+template <typename T>
+class spscRingBuffer {
+private:
+    // Producer owns m_tail, consumer owns m_head. Each side keeps a cached copy of
+    // the other index so the shared cache line is only read when the cache runs out.
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_head{0};
+    alignas(CACHE_LINE_SIZE) size_t m_cached_tail{0};
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_tail{0};
+    alignas(CACHE_LINE_SIZE) size_t m_cached_head{0};
+
+    alignas(CACHE_LINE_SIZE) const size_t m_mask;
+    std::vector<T> m_slots;
+    std::vector<int64_t> m_enqueued_ns;
+    queueNotifier* m_notifier = nullptr;
+    spscQueueStats m_stats;
+
+    static size_t round_up_pow2(size_t n){
+        size_t p = 2;
+        while (p < n) p <<= 1;
+        return p;
+    }
+
+public:
+    // Capacity is rounded up to the next power of two
+    explicit spscRingBuffer(size_t capacity = 1024)
+        : m_mask(round_up_pow2(capacity) - 1), m_slots(m_mask + 1), m_enqueued_ns(m_mask + 1) {}
+
+    spscRingBuffer(const spscRingBuffer&) = delete;
+    spscRingBuffer& operator=(const spscRingBuffer&) = delete;
+
+    // Optional shared notifier, set before the producer starts
+    void attach_notifier(queueNotifier* notifier){
+        m_notifier = notifier;
+    }
+
+    // Producer side. Hands the free slot to fill, which writes the new item in
+    // place and reuses whatever storage the slot still owns. Returns false when
+    // the buffer is full.
+    template <typename Fill>
+    bool push_with(Fill&& fill){
+        const size_t tail = m_tail.load(std::memory_order_relaxed);
+        if (tail - m_cached_head > m_mask) {
+            m_cached_head = m_head.load(std::memory_order_acquire);
+            if (tail - m_cached_head > m_mask) {
+                m_stats.on_drop();
+                return false;
+            }
+        }
+        fill(m_slots[tail & m_mask]);
+        if (spscQueueStats::dwell_sampled(tail)) m_enqueued_ns[tail & m_mask] = queue_clock_ns();
+        m_tail.store(tail + 1, std::memory_order_release);
+        m_stats.on_push();
+        if (m_notifier) m_notifier->notify();
+        return true;
+    }
+
+    bool push_in_queue(const T& item){
+        return push_with([&](T& slot){ slot = item; });
+    }
+
+    bool push_in_queue(T&& item){
+        return push_with([&](T& slot){ slot = std::move(item); });
+    }
+
+    template <typename... Args>
+    bool emplace(Args&&... args){
+        return push_with([&](T& slot){ slot = T(std::forward<Args>(args)...); });
+    }
+
+    // Consumer side. Returns false when the buffer is empty.
+    bool try_pop(T& result){
+        const size_t head = m_head.load(std::memory_order_relaxed);
+        if (head == m_cached_tail) {
+            m_cached_tail = m_tail.load(std::memory_order_acquire);
+            if (head == m_cached_tail) return false;
+            // Depth is sampled on the consumer side, where both indices are fresh
+            m_stats.observe_depth(m_cached_tail - head);
+        }
+        result = std::move(m_slots[head & m_mask]);
+        m_stats.on_pop();
+        if (spscQueueStats::dwell_sampled(head)) m_stats.on_dwell(queue_clock_ns() - m_enqueued_ns[head & m_mask]);
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Producer side. Pushes as many items from the range as fit and publishes them
+    // with a single index store. Returns the number of items pushed.
+    template <typename Range>
+    size_t push_bulk(const Range& items){
+        const size_t tail = m_tail.load(std::memory_order_relaxed);
+        m_cached_head = m_head.load(std::memory_order_acquire);
+        const size_t space = capacity() - (tail - m_cached_head);
+        int64_t now = 0;
+        size_t n = 0;
+        auto it = std::begin(items);
+        for (; it != std::end(items) && n < space; ++it, ++n) {
+            m_slots[(tail + n) & m_mask] = *it;
+            if (spscQueueStats::dwell_sampled(tail + n)) {
+                if (now == 0) now = queue_clock_ns();
+                m_enqueued_ns[(tail + n) & m_mask] = now;
+            }
+        }
+        uint64_t rejected = 0;
+        for (; it != std::end(items); ++it) rejected++;
+        if (rejected > 0) m_stats.on_drop(rejected);
+        if (n > 0) {
+            m_tail.store(tail + n, std::memory_order_release);
+            m_stats.on_push(n);
+            if (m_notifier) m_notifier->notify();
+        }
+        return n;
+    }
+
+    // Consumer side. Moves up to max_n items onto the back of out and releases
+    // the slots with a single index store. Returns the number of items moved.
+    size_t drain_into(std::vector<T>& out, size_t max_n = std::numeric_limits<size_t>::max()){
+        const size_t head = m_head.load(std::memory_order_relaxed);
+        m_cached_tail = m_tail.load(std::memory_order_acquire);
+        m_stats.observe_depth(m_cached_tail - head);
+        const size_t n = std::min(max_n, m_cached_tail - head);
+        int64_t now = 0;
+        for (size_t i = 0; i < n; ++i) {
+            if (spscQueueStats::dwell_sampled(head + i)) {
+                if (now == 0) now = queue_clock_ns();
+                m_stats.on_dwell(now - m_enqueued_ns[(head + i) & m_mask]);
+            }
+            out.push_back(std::move(m_slots[(head + i) & m_mask]));
+        }
+        if (n > 0) {
+            m_head.store(head + n, std::memory_order_release);
+            m_stats.on_pop(n);
+        }
+        return n;
+    }
+
+    // Consumer side. Swaps the next items with out's elements, up to out.size() of
+    // them. The slots keep what out held, so buffers inside T go back to the
+    // producer's push_with instead of being freed. Returns the number swapped.
+    size_t swap_into(std::vector<T>& out){
+        const size_t head = m_head.load(std::memory_order_relaxed);
+        m_cached_tail = m_tail.load(std::memory_order_acquire);
+        m_stats.observe_depth(m_cached_tail - head);
+        const size_t n = std::min(out.size(), m_cached_tail - head);
+        int64_t now = 0;
+        for (size_t i = 0; i < n; ++i) {
+            if (spscQueueStats::dwell_sampled(head + i)) {
+                if (now == 0) now = queue_clock_ns();
+                m_stats.on_dwell(now - m_enqueued_ns[(head + i) & m_mask]);
+            }
+            using std::swap;
+            swap(out[i], m_slots[(head + i) & m_mask]);
+        }
+        if (n > 0) {
+            m_head.store(head + n, std::memory_order_release);
+            m_stats.on_pop(n);
+        }
+        return n;
+    }
+
+    // Consumer side. Calls f(T&) on up to max_n items where they sit, then releases
+    // their slots with a single index store. Unlike drain_into, the slots keep
+    // their storage, so buffers inside T are reused by the next push_with.
+    template <typename F>
+    size_t consume(F&& f, size_t max_n = std::numeric_limits<size_t>::max()){
+        return consume_while([&](T& item){ f(item); return true; }, max_n);
+    }
+
+    // Consumer side. Like consume, but stops at the first item f(T&) returns false
+    // for; that item stays queued at the head.
+    template <typename F>
+    size_t consume_while(F&& f, size_t max_n = std::numeric_limits<size_t>::max()){
+        const size_t head = m_head.load(std::memory_order_relaxed);
+        m_cached_tail = m_tail.load(std::memory_order_acquire);
+        m_stats.observe_depth(m_cached_tail - head);
+        const size_t available = std::min(max_n, m_cached_tail - head);
+        int64_t now = 0;
+        size_t n = 0;
+        for (; n < available; ++n) {
+            if (!f(m_slots[(head + n) & m_mask])) break;
+            if (spscQueueStats::dwell_sampled(head + n)) {
+                if (now == 0) now = queue_clock_ns();
+                m_stats.on_dwell(now - m_enqueued_ns[(head + n) & m_mask]);
+            }
+        }
+        if (n > 0) {
+            m_head.store(head + n, std::memory_order_release);
+            m_stats.on_pop(n);
+        }
+        return n;
+    }
+
+    // Approximate when called concurrently with push/pop
+    bool empty() const {
+        return m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_acquire);
+    }
+
+    size_t size() const {
+        const size_t tail = m_tail.load(std::memory_order_acquire);
+        const size_t head = m_head.load(std::memory_order_acquire);
+        return tail - head;
+    }
+
+    size_t capacity() const {
+        return m_mask + 1;
+    }
+
+    queueStatsSnapshot stats() const {
+        return m_stats.snapshot();
+    }
+};
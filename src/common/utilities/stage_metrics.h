@@ -0,0 +1,59 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+// Plain copy of a stage's counters for reporting
+struct stageMetricsSnapshot {
+    uint64_t items = 0;
+    uint64_t batches = 0;
+    int64_t busy_ns = 0;
+    int64_t max_batch_ns = 0;
+    double avg_item_ns = 0.0;
+};
+
+// Work done by one pipeline stage: how many items it handled and how long it
+// spent handling them. Several threads of the same stage may share one instance.
+class stageMetrics {
+private:
+    std::atomic<uint64_t> m_items{0};
+    std::atomic<uint64_t> m_batches{0};
+    std::atomic<int64_t> m_busy_ns{0};
+    std::atomic<int64_t> m_max_batch_ns{0};
+
+public:
+    void record(uint64_t items, int64_t service_ns){
+        m_items.fetch_add(items, std::memory_order_relaxed);
+        m_batches.fetch_add(1, std::memory_order_relaxed);
+        m_busy_ns.fetch_add(service_ns, std::memory_order_relaxed);
+        int64_t current = m_max_batch_ns.load(std::memory_order_relaxed);
+        while (service_ns > current && !m_max_batch_ns.compare_exchange_weak(current, service_ns, std::memory_order_relaxed)) {}
+    }
+
+    stageMetricsSnapshot snapshot() const {
+        stageMetricsSnapshot s;
+        s.items = m_items.load(std::memory_order_relaxed);
+        s.batches = m_batches.load(std::memory_order_relaxed);
+        s.busy_ns = m_busy_ns.load(std::memory_order_relaxed);
+        s.max_batch_ns = m_max_batch_ns.load(std::memory_order_relaxed);
+        if (s.items > 0) s.avg_item_ns = static_cast<double>(s.busy_ns) / s.items;
+        return s;
+    }
+};
+
+// Times one batch of stage work and records it on finish()
+class stageTimer {
+private:
+    stageMetrics& m_metrics;
+    std::chrono::steady_clock::time_point m_start;
+
+public:
+    explicit stageTimer(stageMetrics& metrics)
+        : m_metrics(metrics), m_start(std::chrono::steady_clock::now()) {}
+
+    void finish(uint64_t items){
+        const auto elapsed = std::chrono::steady_clock::now() - m_start;
+        m_metrics.record(items, std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    }
+};
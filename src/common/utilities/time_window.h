@@ -0,0 +1,255 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+inline int64_t window_clock_ms(){
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()
+    ).count();
+}
+
+// Extra reasons to hand out a window before it is complete. Zero disables a trigger.
+struct windowFlushPolicy {
+    size_t max_batch = 0;        // flush a window once it holds this many items
+    int64_t max_latency_ms = 0;  // flush items that have waited this long since arrival
+};
+
+// Groups items into fixed-width, timestamp-aligned windows kept in a ring of
+// buckets. Insert is O(1); a window is flushed once the watermark (largest
+// timestamp seen) has passed its end by the allowed lateness, or earlier when
+// the flush policy's batch size or latency deadline is hit. Items older than
+// an already flushed window are dropped and counted.
+template <typename T>
+class timeWindowEngine {
+private:
+    static constexpr int64_t NO_WINDOW = std::numeric_limits<int64_t>::min();
+
+    struct bucket {
+        int64_t window = NO_WINDOW;
+        int64_t first_arrival_ms = 0;   // arrival of the oldest item still held
+        std::vector<T> items;
+    };
+
+    const int64_t m_width;
+    const int64_t m_lateness;
+    const windowFlushPolicy m_policy;
+    std::vector<bucket> m_buckets;
+    size_t m_mask;
+
+    int64_t m_watermark = NO_WINDOW;
+    int64_t m_next_flush = NO_WINDOW;   // oldest window not flushed yet
+    int64_t m_flushed_through = NO_WINDOW;   // newest window the watermark has flushed
+    size_t m_pending = 0;
+    uint64_t m_late_dropped = 0;
+
+    // Windows pushed out of the ring by a large timestamp jump before they were
+    // flushed. Only filled when the caller flushes less often than the ring spans.
+    struct evictedWindow {
+        int64_t window;
+        int64_t first_arrival_ms;
+        std::vector<T> items;
+    };
+    std::vector<evictedWindow> m_evicted;
+    std::vector<size_t> m_ready;
+
+    static int64_t floor_div(int64_t a, int64_t b){
+        int64_t q = a / b;
+        if ((a % b != 0) && ((a < 0) != (b < 0))) q--;
+        return q;
+    }
+
+    static size_t ring_size_for(int64_t width, int64_t lateness){
+        // Enough buckets to hold every window that can still accept data, plus slack
+        const size_t needed = static_cast<size_t>(lateness / width) + 3;
+        size_t p = 4;
+        while (p < needed) p <<= 1;
+        return p;
+    }
+
+    bool due(size_t held, int64_t first_arrival_ms, int64_t now_ms) const {
+        return (m_policy.max_batch > 0 && held >= m_policy.max_batch)
+            || (m_policy.max_latency_ms > 0 && now_ms - first_arrival_ms >= m_policy.max_latency_ms);
+    }
+
+    void sort_evicted(){
+        std::stable_sort(m_evicted.begin(), m_evicted.end(),
+                         [](const evictedWindow& a, const evictedWindow& b){ return a.window < b.window; });
+    }
+
+    // Walks the sorted m_evicted from index next through window, emitting the
+    // entries is_due accepts. Emitted entries are left empty for drop_emitted().
+    template <typename Due, typename F>
+    void emit_evicted_up_to(int64_t window, size_t& next, Due&& is_due, size_t& flushed, F& on_window){
+        for (; next < m_evicted.size() && m_evicted[next].window <= window; ++next) {
+            evictedWindow& e = m_evicted[next];
+            if (!is_due(e)) continue;
+            m_pending -= e.items.size();
+            on_window(e.window * m_width, e.items);
+            e.items.clear();
+            flushed++;
+        }
+    }
+
+    void drop_emitted(){
+        m_evicted.erase(std::remove_if(m_evicted.begin(), m_evicted.end(),
+                                       [](const evictedWindow& e){ return e.items.empty(); }),
+                        m_evicted.end());
+    }
+
+    template <typename F>
+    size_t flush_through(int64_t last_window, F& on_window){
+        size_t flushed = 0;
+        if (m_next_flush == NO_WINDOW || last_window < m_next_flush) return 0;
+
+        // The ring is small, so collecting and ordering its due buckets is cheap
+        m_ready.clear();
+        for (size_t i = 0; i < m_buckets.size(); ++i) {
+            if (!m_buckets[i].items.empty() && m_buckets[i].window <= last_window) m_ready.push_back(i);
+        }
+        std::sort(m_ready.begin(), m_ready.end(),
+                  [this](size_t a, size_t b){ return m_buckets[a].window < m_buckets[b].window; });
+        sort_evicted();
+
+        auto any = [](const evictedWindow&){ return true; };
+        size_t next_evicted = 0;
+        for (size_t i : m_ready) {
+            bucket& b = m_buckets[i];
+            emit_evicted_up_to(b.window, next_evicted, any, flushed, on_window);
+            m_pending -= b.items.size();
+            on_window(b.window * m_width, b.items);
+            b.items.clear();
+            flushed++;
+        }
+        emit_evicted_up_to(last_window, next_evicted, any, flushed, on_window);
+        if (next_evicted > 0) drop_emitted();
+        m_next_flush = last_window + 1;
+        m_flushed_through = last_window;
+        return flushed;
+    }
+
+public:
+    timeWindowEngine(int64_t width_ms, int64_t allowed_lateness_ms, windowFlushPolicy policy = {})
+        : m_width(width_ms > 0 ? width_ms : 1),
+          m_lateness(allowed_lateness_ms > 0 ? allowed_lateness_ms : 0),
+          m_policy(policy),
+          m_buckets(ring_size_for(m_width, m_lateness)),
+          m_mask(m_buckets.size() - 1) {
+        m_ready.reserve(m_buckets.size());
+    }
+
+    // Returns false when the item belongs to a window that was already flushed.
+    // arrival_ms is on the window_clock_ms() timeline and drives the latency deadline.
+    bool insert(T&& item, int64_t ts, int64_t arrival_ms){
+        const int64_t w = floor_div(ts, m_width);
+        if (m_flushed_through != NO_WINDOW && w <= m_flushed_through) {
+            m_late_dropped++;
+            return false;
+        }
+        // Until the first flush an item may still land before the first one seen
+        if (m_next_flush == NO_WINDOW || w < m_next_flush) m_next_flush = w;
+        if (ts > m_watermark) m_watermark = ts;
+
+        bucket& b = m_buckets[static_cast<size_t>(w) & m_mask];
+        if (b.window != w) {
+            if (!b.items.empty()) {
+                m_evicted.push_back({b.window, b.first_arrival_ms, std::move(b.items)});
+                b.items = std::vector<T>();
+            }
+            b.window = w;
+        }
+        if (b.items.empty()) b.first_arrival_ms = arrival_ms;
+        b.items.push_back(std::move(item));
+        m_pending++;
+        return true;
+    }
+
+    bool insert(T&& item, int64_t ts){
+        return insert(std::move(item), ts, window_clock_ms());
+    }
+
+    bool insert(const T& item, int64_t ts){
+        T copy(item);
+        return insert(std::move(copy), ts, window_clock_ms());
+    }
+
+    // Hands every complete window to on_window(window_start_ts, std::vector<T>& items)
+    // in window order. The callback may move the items out. Returns windows flushed.
+    template <typename F>
+    size_t flush_ready(F&& on_window){
+        if (m_watermark == NO_WINDOW) return 0;
+        const int64_t last_complete = floor_div(m_watermark - m_lateness, m_width) - 1;
+        return flush_through(last_complete, on_window);
+    }
+
+    // Flushes every pending window regardless of the watermark (shutdown path)
+    template <typename F>
+    size_t flush_all(F&& on_window){
+        if (m_watermark == NO_WINDOW) return 0;
+        return flush_through(floor_div(m_watermark, m_width), on_window);
+    }
+
+    // Flushes complete windows, then any still-open window (evicted ones included)
+    // that has reached the policy's batch size or whose oldest item has waited
+    // max_latency_ms by now_ms.
+    // Partially flushed windows stay open for the rest of their data.
+    template <typename F>
+    size_t flush_due(int64_t now_ms, F&& on_window){
+        size_t flushed = flush_ready(on_window);
+        if (m_policy.max_batch == 0 && m_policy.max_latency_ms == 0) return flushed;
+
+        m_ready.clear();
+        for (size_t i = 0; i < m_buckets.size(); ++i) {
+            const bucket& b = m_buckets[i];
+            if (!b.items.empty() && due(b.items.size(), b.first_arrival_ms, now_ms)) m_ready.push_back(i);
+        }
+        std::sort(m_ready.begin(), m_ready.end(),
+                  [this](size_t a, size_t b){ return m_buckets[a].window < m_buckets[b].window; });
+        sort_evicted();
+
+        auto evicted_due = [&](const evictedWindow& e){ return due(e.items.size(), e.first_arrival_ms, now_ms); };
+        const size_t before = flushed;
+        size_t next_evicted = 0;
+        for (size_t i : m_ready) {
+            bucket& b = m_buckets[i];
+            emit_evicted_up_to(b.window, next_evicted, evicted_due, flushed, on_window);
+            m_pending -= b.items.size();
+            on_window(b.window * m_width, b.items);
+            b.items.clear();
+            flushed++;
+        }
+        emit_evicted_up_to(std::numeric_limits<int64_t>::max(), next_evicted, evicted_due, flushed, on_window);
+        if (flushed - before > m_ready.size()) drop_emitted();
+        return flushed;
+    }
+
+    template <typename F>
+    size_t flush_due(F&& on_window){
+        return flush_due(window_clock_ms(), on_window);
+    }
+
+    // Earliest window_clock_ms() time at which flush_due will hand out a held
+    // item because of the latency deadline, or INT64_MAX when nothing is due.
+    int64_t next_deadline_ms() const {
+        int64_t deadline = std::numeric_limits<int64_t>::max();
+        if (m_policy.max_latency_ms == 0) return deadline;
+        for (const bucket& b : m_buckets) {
+            if (!b.items.empty()) deadline = std::min(deadline, b.first_arrival_ms + m_policy.max_latency_ms);
+        }
+        for (const evictedWindow& e : m_evicted) {
+            deadline = std::min(deadline, e.first_arrival_ms + m_policy.max_latency_ms);
+        }
+        return deadline;
+    }
+
+    int64_t watermark() const { return m_watermark; }
+    int64_t width() const { return m_width; }
+    int64_t allowed_lateness() const { return m_lateness; }
+    size_t pending() const { return m_pending; }
+    uint64_t late_dropped() const { return m_late_dropped; }
+};
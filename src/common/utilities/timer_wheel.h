@@ -0,0 +1,115 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Hierarchical timer wheel over integer ticks. Level l has 64 slots of 64^l ticks
+// each, so four levels cover 64^4 ticks (~4.6 h at 1 ms). Scheduling is O(1) and a
+// timer moves down a level each time its slot comes round, until it fires from
+// level 0. Timers further out than the top level are parked there and re-placed
+// on every cascade.
+template <typename Id>
+class timerWheel {
+public:
+    static constexpr size_t SLOT_BITS = 6;
+    static constexpr size_t SLOTS = size_t(1) << SLOT_BITS;
+    static constexpr size_t LEVELS = 4;
+    static constexpr uint64_t NO_TIMER = UINT64_MAX;
+
+private:
+    struct timer {
+        uint64_t expiry;
+        Id id;
+    };
+
+    std::array<std::array<std::vector<timer>, SLOTS>, LEVELS> m_slots;
+    std::vector<timer> m_scratch;
+    uint64_t m_now;
+    size_t m_count = 0;
+
+    static uint64_t level_span(size_t level){
+        return uint64_t(1) << (SLOT_BITS * level);
+    }
+
+    // A timer due now goes into the current level-0 slot; only cascades do that,
+    // before the slot is processed
+    void place(const timer& t){
+        const uint64_t delta = t.expiry > m_now ? t.expiry - m_now : 0;
+        size_t level = 0;
+        while (level + 1 < LEVELS && delta >= level_span(level + 1)) level++;
+        uint64_t at = t.expiry;
+        if (delta >= level_span(LEVELS)) at = m_now + level_span(LEVELS) - 1;
+        m_slots[level][(at >> (SLOT_BITS * level)) & (SLOTS - 1)].push_back(t);
+    }
+
+    void cascade(size_t level){
+        m_scratch.swap(m_slots[level][(m_now >> (SLOT_BITS * level)) & (SLOTS - 1)]);
+        for (const timer& t : m_scratch) place(t);
+        m_scratch.clear();
+    }
+
+public:
+    explicit timerWheel(uint64_t now_tick = 0) : m_now(now_tick) {}
+
+    // Fires on the first advance() that reaches expiry_tick; anything not in the
+    // future fires on the next tick
+    void schedule(Id id, uint64_t expiry_tick){
+        place(timer{expiry_tick > m_now ? expiry_tick : m_now + 1, id});
+        m_count++;
+    }
+
+    // Moves time forward to to_tick, calling fire(Id) for every timer that expires
+    // on the way in expiry order. fire may schedule new timers.
+    template <typename F>
+    size_t advance(uint64_t to_tick, F&& fire){
+        size_t fired = 0;
+        while (m_now < to_tick) {
+            if (m_count == 0) {
+                m_now = to_tick;
+                break;
+            }
+            ++m_now;
+            for (size_t level = LEVELS - 1; level > 0; --level) {
+                if ((m_now & (level_span(level) - 1)) == 0) cascade(level);
+            }
+
+            std::vector<timer> due;
+            due.swap(m_slots[0][m_now & (SLOTS - 1)]);
+            m_count -= due.size();
+            for (const timer& t : due) {
+                fire(t.id);
+                fired++;
+            }
+            // Hand the storage back so the slot does not reallocate next time round
+            due.clear();
+            if (m_slots[0][m_now & (SLOTS - 1)].empty()) m_slots[0][m_now & (SLOTS - 1)].swap(due);
+        }
+        return fired;
+    }
+
+    // Earliest tick after now() at which advance() can fire anything: the first
+    // occupied level-0 slot, or the cascade of the first occupied slot further up
+    // (its timers expire no earlier). NO_TIMER when the wheel is empty.
+    uint64_t next_due() const {
+        if (m_count == 0) return NO_TIMER;
+        uint64_t due = NO_TIMER;
+        for (size_t level = 0; level < LEVELS; ++level) {
+            const uint64_t current = m_now >> (SLOT_BITS * level);
+            // A full turn ahead maps onto the current slot index
+            for (uint64_t ahead = 1; ahead <= SLOTS; ++ahead) {
+                const uint64_t slot_start = (current + ahead) << (SLOT_BITS * level);
+                if (slot_start >= due) break;
+                if (!m_slots[level][(current + ahead) & (SLOTS - 1)].empty()) {
+                    due = slot_start;
+                    break;
+                }
+            }
+        }
+        return due;
+    }
+
+    uint64_t now() const { return m_now; }
+    size_t size() const { return m_count; }
+};
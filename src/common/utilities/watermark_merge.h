@@ -0,0 +1,155 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <set>
+#include <utility>
+#include <vector>
+
+// Merges N per-source streams into one stream ordered by timestamp. Each source
+// is expected to deliver its own items in timestamp order. An item is released
+// once every live source has either queued something newer or advanced its low
+// watermark past it. Sources that go quiet for idle_timeout_ms, or are closed,
+// stop holding the merge back. Cost is O(log N) per item.
+template <typename T>
+class watermarkMerger {
+private:
+    static constexpr int64_t NO_WATERMARK = std::numeric_limits<int64_t>::min();
+
+    enum class sourceState { Active, Idle, Closed };
+
+    struct source {
+        std::deque<std::pair<int64_t, T>> buffer;
+        int64_t watermark = NO_WATERMARK;
+        int64_t last_activity_ms = 0;
+        sourceState state = sourceState::Active;
+    };
+
+    using head_entry = std::pair<int64_t, size_t>;   // (head timestamp, source)
+
+    std::vector<source> m_sources;
+    // One entry per source with buffered items, keyed by its head timestamp
+    std::priority_queue<head_entry, std::vector<head_entry>, std::greater<head_entry>> m_heads;
+    // Live sources with nothing buffered: their watermark bounds what can be released
+    std::set<std::pair<int64_t, size_t>> m_blocking;
+    int64_t m_idle_timeout_ms;
+    size_t m_buffered = 0;
+
+    bool is_blocking(const source& s) const {
+        return s.state == sourceState::Active && s.buffer.empty();
+    }
+
+    int64_t release_bound() const {
+        return m_blocking.empty() ? std::numeric_limits<int64_t>::max() : m_blocking.begin()->first;
+    }
+
+    template <typename F>
+    void emit_head(F& emit){
+        const size_t id = m_heads.top().second;
+        m_heads.pop();
+        source& s = m_sources[id];
+        auto [ts, item] = std::move(s.buffer.front());
+        s.buffer.pop_front();
+        m_buffered--;
+        if (!s.buffer.empty()) {
+            m_heads.emplace(s.buffer.front().first, id);
+        } else if (is_blocking(s)) {
+            m_blocking.emplace(s.watermark, id);
+        }
+        emit(std::move(item), ts);
+    }
+
+public:
+    // idle_timeout_ms of 0 disables idle detection; only close() then unblocks a source
+    explicit watermarkMerger(size_t source_count = 0, int64_t idle_timeout_ms = 0)
+        : m_idle_timeout_ms(idle_timeout_ms) {
+        for (size_t i = 0; i < source_count; ++i) add_source();
+    }
+
+    size_t add_source(int64_t now_ms = 0){
+        const size_t id = m_sources.size();
+        m_sources.emplace_back();
+        m_sources.back().last_activity_ms = now_ms;
+        m_blocking.emplace(NO_WATERMARK, id);
+        return id;
+    }
+
+    void push(size_t id, T&& item, int64_t ts, int64_t now_ms){
+        source& s = m_sources[id];
+        if (is_blocking(s)) m_blocking.erase({s.watermark, id});
+        if (s.state == sourceState::Idle) s.state = sourceState::Active;
+        s.last_activity_ms = now_ms;
+
+        if (s.buffer.empty()) m_heads.emplace(ts, id);
+        s.buffer.emplace_back(ts, std::move(item));
+        if (ts > s.watermark) s.watermark = ts;
+        m_buffered++;
+    }
+
+    // Promise that source id will not deliver anything older than watermark
+    void advance(size_t id, int64_t watermark, int64_t now_ms){
+        source& s = m_sources[id];
+        if (watermark <= s.watermark) return;
+        const bool blocking = is_blocking(s);
+        if (blocking) m_blocking.erase({s.watermark, id});
+        s.watermark = watermark;
+        s.last_activity_ms = now_ms;
+        if (blocking) m_blocking.emplace(s.watermark, id);
+    }
+
+    // A stopped source never holds the merge back again; its buffered items still drain
+    void close(size_t id){
+        source& s = m_sources[id];
+        if (is_blocking(s)) m_blocking.erase({s.watermark, id});
+        s.state = sourceState::Closed;
+    }
+
+    bool closed(size_t id) const {
+        return m_sources[id].state == sourceState::Closed;
+    }
+
+    // Stops waiting for sources that have been silent for the idle timeout.
+    // O(N), so call it when the caller is about to sleep rather than per item.
+    void expire_idle(int64_t now_ms){
+        if (m_idle_timeout_ms <= 0) return;
+        for (size_t id = 0; id < m_sources.size(); ++id) {
+            source& s = m_sources[id];
+            if (is_blocking(s) && now_ms - s.last_activity_ms >= m_idle_timeout_ms) {
+                m_blocking.erase({s.watermark, id});
+                s.state = sourceState::Idle;
+            }
+        }
+    }
+
+    // Emits every releasable item in timestamp order through emit(T&&, int64_t ts)
+    template <typename F>
+    size_t pop_ready(F&& emit){
+        size_t emitted = 0;
+        while (!m_heads.empty() && m_heads.top().first <= release_bound()) {
+            emit_head(emit);
+            emitted++;
+        }
+        return emitted;
+    }
+
+    // Emits everything still buffered, in timestamp order (shutdown path)
+    template <typename F>
+    size_t flush_all(F&& emit){
+        size_t emitted = 0;
+        while (!m_heads.empty()) {
+            emit_head(emit);
+            emitted++;
+        }
+        return emitted;
+    }
+
+    size_t source_count() const { return m_sources.size(); }
+    size_t buffered() const { return m_buffered; }
+
+    // Timestamp up to which the merged output is final
+    int64_t low_watermark() const { return release_bound(); }
+};
@@ -6,9 +6,29 @@
 #include <mutex>
 #include <fstream>
 #include <iomanip>
-#include <map>
+#include <vector>
+#include <unordered_map>
+#include <memory>
+#include <set>
+#include <limits>
+#include <system_error>
+#include <algorithm>
 // #include "utilites/safe_queue.h"
 #include "utilities/safe_queue.h"
+#include "utilities/spsc_ring_buffer.h"
+#include "utilities/queue_notifier.h"
+#include "utilities/time_window.h"
+#include "utilities/watermark_merge.h"
+#include "utilities/sharded_aggregator.h"
+#include "utilities/channel_sequencer.h"
+#include "utilities/stage_metrics.h"
+#include "utilities/sensor_scheduler.h"
+#include "utilities/load_generator.h"
+#include "utilities/mapped_file.h"
+#include "utilities/replay_reader.h"
+#include "utilities/channel_registry.h"
+#include "utilities/dds_qos.h"
+#include "utilities/option_values.h"
 #include "dds/dds.hpp"
 #include "spdlog/spdlog.h"
 #include "spdlog/async.h"
@@ -16,6 +36,7 @@
 #include "message_schema.hpp"
 #include "Sensor_wrapper.hpp"
 #include "Serializer/sensor.pb.h"
+#include "Serializer/frame_codec.h"
 
 using namespace org::eclipse::cyclonedds;
 
@@ -23,7 +44,11 @@ using namespace org::eclipse::cyclonedds;
 std::atomic<bool> ctrl_switch_temp{false};
 std::atomic<bool> ctrl_switch_pressure{false};
 std::atomic<bool> ctrl_switch_flow{false};
+std::atomic<bool> ctrl_switch_load{false};
+std::atomic<bool> ctrl_switch_replay{false};
 std::atomic<bool> ctrl_switch_aggregator{false};
+std::atomic<bool> ctrl_switch_writer{false};
+std::atomic<bool> ctrl_switch_dashboard{false};
 
 // Thread safe counters
 std::atomic<uint32_t> seq_counter{0};
@@ -34,67 +59,241 @@ std::atomic<uint32_t> flow_seq_counter{0};
 std::mutex log_mutex;
 std::mutex dashboard_mutex;
 
-// Dashboard state
-std::map<std::string, double> latest_value;
-std::map<std::string, uint64_t> latest_timestamp;
-std::map<std::string, uint32_t> latest_seq;
-std::map<std::string, uint32_t> published_count;
-
-void temp_sensor_data(safeQueue<sensorData::msg>& squeue, double_t min_temp, double_t max_temp){
-    static std::random_device RD_T;
-    std::uniform_real_distribution<double_t> dis_generator(min_temp, max_temp);
-
-    while(!ctrl_switch_temp){
-        sensorData::msg temp_meassge;
-        temp_meassge.sensor_id("Temp-Sensor");
-        temp_meassge.value(dis_generator(RD_T));
-        temp_meassge.timeStamp(std::chrono::duration_cast<std::chrono::milliseconds>(
-                std::chrono::system_clock::now().time_since_epoch()
-            ).count()
-        );
-        temp_meassge.sequence_num(temp_seq_counter++);
-        squeue.push_in_queue(temp_meassge);
-        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+// Every channel (sensor, load or replay) is registered here before the pipeline
+// starts. Readings carry only the id; the names go out once on the dictionary topic.
+channelRegistry channel_registry;
+
+// Dashboard state, indexed by channel id
+struct channelDashboard {
+    double value = 0.0;
+    uint64_t timestamp = 0;
+    uint32_t seq = 0;
+    uint32_t published = 0;
+};
+std::vector<channelDashboard> dashboard_channels;
+
+// Each sensor thread is the only producer and the aggregator the only consumer of its link
+using sensor_link = spscRingBuffer<sensorData::msg>;
+const size_t SENSOR_LINK_CAPACITY = 4096;
+// Shared by all sensor links so the aggregator sleeps until any of them has data
+queueNotifier sensor_notifier;
+// The other way round: bumped after each pass that took samples, so a lossless
+// producer (replay) can sleep while its link is full
+queueNotifier sensor_space_notifier;
+const auto AGGREGATOR_IDLE_WAIT = std::chrono::milliseconds(100);
+// Upper bound on samples taken from one link per pass, keeps the links fairly served
+const size_t AGGREGATOR_DRAIN_BATCH = 256;
+// Window width matches the old 1 s grouping tolerance; lateness covers cross-link skew
+const int64_t AGGREGATION_WINDOW_MS = 1000;
+const int64_t AGGREGATION_LATENESS_MS = 200;
+// Flush triggers bounding end-to-end latency independently of the window width
+const size_t AGGREGATOR_MAX_BATCH = 64;
+const int64_t AGGREGATOR_MAX_LATENCY_MS = 50;
+// A sensor silent for this long stops holding back the time-ordered merge
+const int64_t MERGE_IDLE_TIMEOUT_MS = 500;
+// One entry per sensor: its link into the aggregator and the switch that stops it
+struct sensorLinkInfo {
+    std::string name;
+    sensor_link* link;
+    const std::atomic<bool>* stopped;
+};
+std::vector<sensorLinkInfo> sensor_links;
+
+// The publisher runs as a pipeline, each stage on its own thread(s):
+//   acquire   (sensor threads)  -> sensor links
+//   aggregate (merge + windows) -> encode pool, sharded by sensor
+//   encode    (log + protobuf)  -> one encoded link per encode worker
+//   write     (DDS writer, frames back in per-channel order)
+// Handoff between stages is lock-free SPSC. A stolen channel's frames can sit in
+// two encoded links at once, so each frame is stamped by encode_sequencer and the
+// writer takes them in stamp order; per-sensor order is preserved end to end.
+// 0 encode workers means one per core.
+const size_t ENCODE_WORKERS = 0;
+using encode_pool = shardedAggregator<sensorData::msg>;
+
+// An encoded frame on its way to the writer, with the readings it carries for the
+// dashboard. Link slots are filled and written in place, so the payload and the
+// readings vector keep their capacity from one frame to the next.
+struct encodedSample {
+    std::vector<sensorData::msg> readings;
+    SensorData::ChannelFrame sample;
+    uint64_t stamp = 0;   // frame number within its channel
+};
+using encoded_link = spscRingBuffer<encodedSample>;
+const size_t ENCODED_LINK_CAPACITY = 4096;
+queueNotifier encoded_notifier;
+const auto WRITER_IDLE_WAIT = std::chrono::milliseconds(100);
+const size_t WRITER_DRAIN_BATCH = 256;
+std::vector<std::unique_ptr<encoded_link>> encoded_links;
+std::unique_ptr<channelSequencer> encode_sequencer;
+
+// Readings are batched into frames, one DDS sample each. A frame holds one channel
+// (the topic is keyed by it) and is written once it holds FRAME_MAX_READINGS or at
+// the end of the encode pool batch it came from. A partial frame is never kept past
+// the batch: the pool may hand the channel to another worker next, whose newer
+// frame would then go out first.
+const size_t FRAME_MAX_READINGS = 256;
+std::atomic<uint64_t> frames_written{0};
+// --codec picks the frame wire format; --compress makes protobuf frames carry a
+// Gorilla block instead of the raw columns. Both are set before the encoders start.
+frameCodec frame_codec = frameCodec::Protobuf;
+bool frame_compression = false;
+
+// Endpoint QoS comes from named profiles (--qos, --qos-file); the subscriber must
+// use the same telemetry profile. History is kept per channel (topic instance).
+qosProfileSet qos_profiles;
+std::string telemetry_qos_profile = qosProfileSet::LATE_JOIN_SNAPSHOT;
+
+// Rendering runs on its own thread so a slow terminal never holds up publishing
+const auto DASHBOARD_REFRESH = std::chrono::milliseconds(500);
+// Load-generator runs publish many channels; only the first ones get a row
+const size_t DASHBOARD_MAX_SENSOR_ROWS = 16;
+
+stageMetrics aggregate_stage;
+stageMetrics encode_stage;
+stageMetrics write_stage;
+
+// Sensors are sampled by a timer-wheel scheduler on a small pool instead of a
+// thread each; every sensor has its own period and absolute deadlines
+const size_t SENSOR_SCHEDULER_WORKERS = 1;
+const auto SENSOR_PERIOD = std::chrono::milliseconds(100);
+sensorScheduler sensor_scheduler(SENSOR_SCHEDULER_WORKERS);
+
+// A simulated sensor producing uniformly distributed readings into its own link
+struct simulatedSensor {
+    std::string name;
+    uint32_t channel;
+    double_t min_value;
+    double_t max_value;
+    std::chrono::milliseconds period;
+    sensor_link* link;
+    const std::atomic<bool>* stopped;
+    std::atomic<uint32_t>* seq;
+    xoshiro256 engine{std::random_device{}()};
+};
+
+// Scheduler callback, one reading per deadline. Returns false once the sensor is stopped.
+bool sample_sensor(simulatedSensor& sensor){
+    if(sensor.stopped->load()){
+        spdlog::info("ERROR::{} shutting down", sensor.name);
+        return false;
     }
-    spdlog::info("ERROR::Temperature sensor shutting down");
+    std::uniform_real_distribution<double_t> dis_generator(sensor.min_value, sensor.max_value);
+    sensorData::msg message;
+    message.channel(sensor.channel);
+    message.value(dis_generator(sensor.engine));
+    message.timeStamp(std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()
+        ).count()
+    );
+    message.sequence_num((*sensor.seq)++);
+    // A full link rejects the sample; drops are counted in the link stats
+    sensor.link->push_in_queue(std::move(message));
+    return true;
+}
+
+// Load-generator mode: synthetic channels whose readings come in batches from a
+// fast per-thread PRNG. Each generator thread owns one link into the aggregator,
+// exactly like a sensor, and cycles through its channels.
+const size_t LOAD_GEN_BATCH = 256;
+struct loadGenConfig {
+    size_t threads = 0;                 // 0 disables load generation
+    size_t channels_per_thread = 64;
+    double readings_per_second = 0;     // per thread; 0 runs as fast as possible
+    valueDistribution values{valueShape::Normal, 500.0, 50.0};   // --load-values
+};
+
+std::string load_channel_name(size_t thread_id, size_t channel){
+    return "Load-" + std::to_string(thread_id) + "-" + std::to_string(channel);
 }
 
-void press_sensor_data(safeQueue<sensorData::msg>& squeue, double_t min_press, double_t max_press){
-    static std::random_device RD_T;
-    std::uniform_real_distribution<double_t> dis_generator(min_press, max_press);
-
-    while(!ctrl_switch_pressure){
-        sensorData::msg pressure_meassge;
-        pressure_meassge.sensor_id("Press-Sensor");
-        pressure_meassge.value(dis_generator(RD_T)); 
-        pressure_meassge.timeStamp(std::chrono::duration_cast<std::chrono::milliseconds>(
-                std::chrono::system_clock::now().time_since_epoch()
-            ).count()
-        );
-        pressure_meassge.sequence_num(pres_seq_counter++);
-        squeue.push_in_queue(pressure_meassge);
-        std::this_thread::sleep_for(std::chrono::milliseconds(100));       
+// A thread's channels are registered consecutively, starting at first_channel
+void load_generator(size_t thread_id, const loadGenConfig& config, uint32_t first_channel, sensor_link& link){
+    loadGenerator values(config.values, 0x10ad + thread_id);
+    std::vector<uint32_t> seqs(config.channels_per_thread, 0);
+    std::vector<double> batch(LOAD_GEN_BATCH);
+    size_t channel = 0;
+
+    // Batches are paced against absolute deadlines so the configured rate holds
+    const auto batch_interval = std::chrono::nanoseconds(config.readings_per_second > 0
+        ? static_cast<int64_t>(LOAD_GEN_BATCH * 1e9 / config.readings_per_second) : 0);
+    auto next_batch = std::chrono::steady_clock::now();
+
+    while(!ctrl_switch_load){
+        values.generate(batch);
+        const int64_t ts = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()
+        ).count();
+        for(double value: batch){
+            // Readings are built in the link slot; a full link rejects them like a sensor's
+            link.push_with([&](sensorData::msg& slot){
+                slot.channel(first_channel + static_cast<uint32_t>(channel));
+                slot.value(value);
+                slot.timeStamp(ts);
+                slot.sequence_num(seqs[channel]++);
+            });
+            channel = (channel + 1) % seqs.size();
+        }
+        if(batch_interval.count() > 0){
+            next_batch += batch_interval;
+            std::this_thread::sleep_until(next_batch);
+        }
     }
-    spdlog::info("ERROR::Pressure sensor shutting down");
+    spdlog::info("Load generator {} shutting down", thread_id);
 }
 
-void flow_sensor_data(safeQueue<sensorData::msg>& squeue, double_t min_rate, double_t max_rate){
-    static std::random_device RD_P;
-    std::uniform_real_distribution<double_t> dis_generator(min_rate, max_rate);
-
-    while(!ctrl_switch_flow){
-        sensorData::msg flow_message;
-        flow_message.sensor_id("flow-Sensor");
-        flow_message.value(dis_generator(RD_P));
-        flow_message.timeStamp(std::chrono::duration_cast<std::chrono::milliseconds>(
-                std::chrono::system_clock::now().time_since_epoch()
-            ).count()
-        );
-        flow_message.sequence_num(flow_seq_counter++);
-        squeue.push_in_queue(flow_message);
-        std::this_thread::sleep_for(std::chrono::milliseconds(100)); 
+// Replay mode: recorded publish logs (or legacy CSV logs) are streamed back in,
+// one thread and one link per file, so the aggregator merges them like sensors.
+// Records keep their sensor, value and sequence number and are stamped with the
+// time they are injected. Speed 1 keeps the recorded cadence, N plays N times
+// faster and 0 goes as fast as the pipeline accepts.
+const auto REPLAY_FULL_WAIT = std::chrono::milliseconds(10);
+struct replayConfig {
+    std::vector<std::string> files;
+    double speed = 1.0;
+};
+std::atomic<size_t> replay_sources_running{0};
+
+void replay_source(const mappedFile& file, sensor_link& link, double speed, int64_t first_ts,
+                   std::chrono::steady_clock::time_point start, std::atomic<bool>& done){
+    replayReader reader(file.view());
+    replayRecord rec;
+    uint64_t replayed = 0;
+    // Consecutive records mostly share a sensor, so the registry is only asked on a change.
+    // main() registered every sensor in the file.
+    std::string_view last_sensor;
+    uint32_t channel = 0;
+    while(!ctrl_switch_replay && reader.next(rec)){
+        if(speed > 0){
+            const std::chrono::duration<double, std::milli> offset((rec.timestamp - first_ts) / speed);
+            std::this_thread::sleep_until(start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(offset));
+        }
+        // Replay is lossless: wait for the aggregator instead of dropping. The bounded
+        // wait keeps the stop switch checked if the aggregator has already gone.
+        while(!ctrl_switch_replay){
+            const uint64_t seen_epoch = sensor_space_notifier.epoch();
+            if(link.size() < link.capacity()) break;
+            sensor_space_notifier.wait_for(seen_epoch, REPLAY_FULL_WAIT);
+        }
+        const int64_t ts = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()
+        ).count();
+        if(rec.sensor_id != last_sensor){
+            channel_registry.find(rec.sensor_id, channel);
+            last_sensor = rec.sensor_id;
+        }
+        link.push_with([&](sensorData::msg& slot){
+            slot.channel(channel);
+            slot.value(rec.value);
+            slot.timeStamp(ts);
+            slot.sequence_num(rec.sequence_num);
+        });
+        replayed++;
     }
-    spdlog::info("ERROR::Flow sensor shutting down");
+    spdlog::info("Replay source finished: {} samples, {} lines skipped", replayed, reader.skipped());
+    done.store(true);
+    replay_sources_running--;
+    sensor_notifier.notify();
 }
 
 // LOGGING - SECTION
@@ -102,7 +301,7 @@ void flow_sensor_data(safeQueue<sensorData::msg>& squeue, double_t min_rate, dou
 void log_message(const sensorData::msg& msg){
     std::ofstream logFile("Publisher-Log.csv", std::ios::app);
     std::lock_guard<std::mutex> lock(log_mutex);    
-    logFile<< msg.sensor_id() << " " << msg.value() << " " << msg.timeStamp() << " " << msg.sequence_num() << "\n";
+    logFile<< channel_registry.name(msg.channel()) << " " << msg.value() << " " << msg.timeStamp() << " " << msg.sequence_num() << "\n";
 }
 // Curently used
 void init_logging(){
@@ -127,7 +326,7 @@ void init_logging(){
 
 
 void on_publish_log_message(const sensorData::msg& msg_data){
-    spdlog::info("PUB sensor={} value={} ts={} seq={}", msg_data.sensor_id(), msg_data.value(), msg_data.timeStamp(), msg_data.sequence_num());
+    spdlog::info("PUB sensor={} value={} ts={} seq={}", channel_registry.name(msg_data.channel()), msg_data.value(), msg_data.timeStamp(), msg_data.sequence_num());
 }
 
 void clear_terminal() {
@@ -147,91 +346,286 @@ void printPublisherDashboard() {
               << std::setw(12) << "Published" << "\n";
     std::cout << std::string(70, '-') << "\n";
     
-    for (const auto& [sensor, value] : latest_value) {
+    size_t rows = 0;
+    uint32_t total_published = 0;
+    for (uint32_t channel = 0; channel < dashboard_channels.size(); ++channel) {
+        const channelDashboard& state = dashboard_channels[channel];
+        if (state.published == 0) continue;
+        total_published += state.published;
+        if (++rows > DASHBOARD_MAX_SENSOR_ROWS) continue;
         std::cout << std::left 
-                  << std::setw(15) << sensor
-                  << std::setw(12) << std::fixed << std::setprecision(2) << value
-                  << std::setw(18) << latest_timestamp[sensor]
-                  << std::setw(8) << latest_seq[sensor]
-                  << std::setw(12) << published_count[sensor] << "\n";
+                  << std::setw(15) << channel_registry.name(channel)
+                  << std::setw(12) << std::fixed << std::setprecision(2) << state.value
+                  << std::setw(18) << state.timestamp
+                  << std::setw(8) << state.seq
+                  << std::setw(12) << state.published << "\n";
     }
-    
-    uint32_t total_published = 0;
-    for (const auto& [sensor, count] : published_count) {
-        total_published += count;
+    if (rows > DASHBOARD_MAX_SENSOR_ROWS) {
+        std::cout << "... " << rows - DASHBOARD_MAX_SENSOR_ROWS << " more\n";
     }
     
     std::cout << "\n" << std::string(70, '=') << "\n";
-    std::cout << "TOTAL PUBLISHED: " << total_published << " messages\n";
+    std::cout << "TOTAL PUBLISHED: " << total_published << " messages in " << frames_written.load() << " frames\n";
     std::cout << std::string(70, '=') << "\n";
+
+    std::cout << "\n" << std::left
+              << std::setw(15) << "Link"
+              << std::setw(8) << "Depth"
+              << std::setw(8) << "HWM"
+              << std::setw(10) << "Dropped"
+              << std::setw(14) << "AvgDwell(us)"
+              << std::setw(14) << "MaxDwell(us)" << "\n";
+    std::cout << std::string(70, '-') << "\n";
+    for (const auto& info : sensor_links) {
+        const queueStatsSnapshot stats = info.link->stats();
+        std::cout << std::left
+                  << std::setw(15) << info.name
+                  << std::setw(8) << info.link->size()
+                  << std::setw(8) << stats.high_water
+                  << std::setw(10) << stats.dropped
+                  << std::setw(14) << std::fixed << std::setprecision(1) << stats.dwell_avg_ns / 1000.0
+                  << std::setw(14) << stats.dwell_max_ns / 1000 << "\n";
+    }
+
+    std::cout << "\n" << std::left
+              << std::setw(15) << "Schedule"
+              << std::setw(10) << "Fired"
+              << std::setw(10) << "Missed"
+              << std::setw(12) << "p50Jit(us)"
+              << std::setw(12) << "p99Jit(us)"
+              << std::setw(12) << "MaxJit(us)" << "\n";
+    std::cout << std::string(70, '-') << "\n";
+    for (size_t i = 0; i < sensor_scheduler.channel_count() && i < sensor_links.size(); ++i) {
+        const sensorScheduler::channelStats stats = sensor_scheduler.stats(i);
+        std::cout << std::left
+                  << std::setw(15) << sensor_links[i].name
+                  << std::setw(10) << stats.fired
+                  << std::setw(10) << stats.missed
+                  << std::setw(12) << stats.jitter.p50_ns / 1000
+                  << std::setw(12) << stats.jitter.p99_ns / 1000
+                  << std::setw(12) << stats.jitter.max_ns / 1000 << "\n";
+    }
+
+    // Encoded links are summed: they feed the same writer
+    queueStatsSnapshot encoded;
+    size_t encoded_depth = 0;
+    for (const auto& link : encoded_links) {
+        const queueStatsSnapshot stats = link->stats();
+        encoded.high_water = std::max(encoded.high_water, stats.high_water);
+        encoded.dropped += stats.dropped;
+        encoded_depth += link->size();
+    }
+
+    std::cout << "\n" << std::left
+              << std::setw(15) << "Stage"
+              << std::setw(12) << "Items"
+              << std::setw(14) << "AvgSvc(us)"
+              << std::setw(14) << "MaxBatch(us)"
+              << std::setw(15) << "InDepth/HWM" << "\n";
+    std::cout << std::string(70, '-') << "\n";
+    auto print_stage = [](const char* name, const stageMetrics& metrics, const std::string& queue){
+        const stageMetricsSnapshot s = metrics.snapshot();
+        std::cout << std::left
+                  << std::setw(15) << name
+                  << std::setw(12) << s.items
+                  << std::setw(14) << std::fixed << std::setprecision(1) << s.avg_item_ns / 1000.0
+                  << std::setw(14) << s.max_batch_ns / 1000
+                  << std::setw(15) << queue << "\n";
+    };
+    print_stage("aggregate", aggregate_stage, "-");
+    print_stage("encode", encode_stage, "-");
+    print_stage("write", write_stage, std::to_string(encoded_depth) + "/" + std::to_string(encoded.high_water));
 }
 
-void aggregrator(safeQueue<sensorData::msg>& temp, safeQueue<sensorData::msg>& pressure, safeQueue<sensorData::msg>& flow, dds::pub::DataWriter<SensorData::RawSensorData>& sensorWriter){
+void dashboard_loop(){
+    while (!ctrl_switch_dashboard){
+        printPublisherDashboard();
+        std::this_thread::sleep_for(DASHBOARD_REFRESH);
+    }
+    printPublisherDashboard();
+}
+
+// Encode state reused across frames so the steady state encodes without heap allocations
+struct encodeState {
+    frameEncoder encoder{frame_codec, frame_compression};
+    std::vector<sensorData::msg> readings;   // readings in the frame being built
+    uint32_t channel = 0;                    // channel of those readings
+
+    encodeState(){
+        readings.reserve(FRAME_MAX_READINGS);
+    }
+};
+
+// Serializes the frame being built straight into a writer link slot
+void flush_frame(encodeState& state, encoded_link& out){
+    if(state.readings.empty()) return;
+    // Sized once up front; the encoder then writes exactly that many bytes
+    const size_t frame_bytes = state.encoder.encoded_size();
+
+    // Back-pressure: wait for the writer rather than dropping
+    auto fill = [&](encodedSample& slot){
+        // SERIALZED BUFFER CREATED in the DDS sample itself (keeps the slot's capacity)
+        auto& bytes = slot.sample.data();
+        bytes.resize(frame_bytes);
+        state.encoder.write_to(bytes.data());
+        slot.sample.channel(state.channel);
+        slot.stamp = encode_sequencer->next(state.channel);
+        slot.readings.swap(state.readings);
+    };
+    while(!out.push_with(fill)){
+        std::this_thread::yield();
+    }
+    // The encoder keeps its storage for the next frame
+    state.readings.clear();
+}
+
+// Encode stage: logs each sample and appends it to this worker's frame. Frames
+// carry channel ids only; subscribers name them from the channel dictionary.
+// A batch holds one channel's readings and leaves no partial frame behind.
+void encode_batch(uint32_t channel, std::vector<sensorData::msg>& batch, encodeState& state, encoded_link& out){
+    stageTimer timer(encode_stage);
+    state.channel = channel;
+    for(auto& msg: batch){
+        // Depriciated
+        // log_message(msg);
+
+        //Loggint message using spdlog into log/async_publish_log.txt
+        on_publish_log_message(msg);
+
+        // FRAME ENCODING (--codec)
+        state.encoder.add(msg.channel(), msg.value(), msg.timeStamp(), msg.sequence_num());
+        state.readings.push_back(std::move(msg));
+
+        if(state.readings.size() >= FRAME_MAX_READINGS){
+            flush_frame(state, out);
+        }
+    }
+    flush_frame(state, out);
+    timer.finish(batch.size());
+}
+
+// Write stage: the only thread touching the DDS writer. Samples are written straight
+// from the link slots; dashboard state is updated here, rendering happens elsewhere.
+// Every channel's instance is registered up front so writes skip the key lookup.
+void writer(dds::pub::DataWriter<SensorData::ChannelFrame>& sensorWriter){
+    std::vector<dds::core::InstanceHandle> instances;
+    SensorData::ChannelFrame key;
+    for(uint32_t channel = 0; channel < channel_registry.size(); ++channel){
+        key.channel(channel);
+        instances.push_back(sensorWriter.register_instance(key));
+    }
+
+    size_t readings_written = 0;
+    auto write_sample = [&](encodedSample& slot){
+        sensorWriter.write(slot.sample, instances[slot.sample.channel()]);
+        seq_counter += static_cast<uint32_t>(slot.readings.size());
+        frames_written++;
+        readings_written += slot.readings.size();
+
+        // Update dashboard state, once per frame
+        std::lock_guard<std::mutex> lock(dashboard_mutex);
+        for(const sensorData::msg& msg: slot.readings){
+            channelDashboard& state = dashboard_channels[msg.channel()];
+            state.value = msg.value();
+            state.timestamp = msg.timeStamp();
+            state.seq = msg.sequence_num();
+            state.published++;
+        }
+    };
+
+    auto order_of = [](const encodedSample& slot){
+        return std::pair<size_t, uint64_t>{slot.sample.channel(), slot.stamp};
+    };
+
+    while(true){
+        const uint64_t seen_epoch = encoded_notifier.epoch();
+        stageTimer timer(write_stage);
+        readings_written = 0;
+        bool waiting = false;
+        const size_t written = encode_sequencer->drain(encoded_links, WRITER_DRAIN_BATCH, order_of, write_sample, waiting);
+        if(written > 0){
+            timer.finish(readings_written);
+            continue;
+        }
+        // A frame's predecessor is in a link already passed over; it is there by now
+        if(waiting) continue;
+        // Stopped only after the encode pool has drained, so nothing is left behind
+        if(ctrl_switch_writer) break;
+        encoded_notifier.wait_for(seen_epoch, WRITER_IDLE_WAIT);
+    }
+}
+
+void aggregrator(const std::vector<sensorLinkInfo>& links, encode_pool& encoders){
     std::vector<sensorData::msg> temporary_container;
-    const int16_t TOLLARANCE_IN_MS = 1000;
-    sensor_proto::proto_serial_data proto_msg_data;
-    SensorData::RawSensorData buffer_to_dds;
-    sensorData::msg data;
-    int msg_count = 0;
+    // Samples are grouped into aligned windows of AGGREGATION_WINDOW_MS
+    // A window is published when complete, when it holds AGGREGATOR_MAX_BATCH samples,
+    // or when its oldest sample has waited AGGREGATOR_MAX_LATENCY_MS, whichever comes first
+    windowFlushPolicy flush_policy;
+    flush_policy.max_batch = AGGREGATOR_MAX_BATCH;
+    flush_policy.max_latency_ms = AGGREGATOR_MAX_LATENCY_MS;
+    timeWindowEngine<sensorData::msg> window_engine(AGGREGATION_WINDOW_MS, AGGREGATION_LATENESS_MS, flush_policy);
+
+    auto publish_window = [&](int64_t /*window_start*/, std::vector<sensorData::msg>& group){
+        for(auto& msg: group){
+            // Encode pool channels were added in registry order, so the ids match
+            const size_t channel = msg.channel();
+            // Back-pressure: wait for the encode worker rather than dropping
+            while(!encoders.submit(channel, std::move(msg))){
+                std::this_thread::yield();
+            }
+        }
+    };
+
+    // Links are merged into one timestamp-ordered stream before windowing. A sensor
+    // that is stopped (T/P/F) is closed in the merge so it cannot stall the others.
+    watermarkMerger<sensorData::msg> merger(links.size(), MERGE_IDLE_TIMEOUT_MS);
+    int64_t now_ms = window_clock_ms();
+
+    auto to_window = [&](sensorData::msg&& msg, int64_t ts){
+        if(!window_engine.insert(std::move(msg), ts, now_ms)){
+            spdlog::warn("Late sample dropped ts={} watermark={}", ts, window_engine.watermark());
+        }
+    };
 
     while (!ctrl_switch_aggregator){
-        if(temp.try_pop(data)) temporary_container.push_back(data); 
-        if(pressure.try_pop(data)) temporary_container.push_back(data); 
-        if(flow.try_pop(data)) temporary_container.push_back(data); 
-
-        while(!temporary_container.empty()){
-            auto ref_timestamp = temporary_container.front().timeStamp();
-            std::vector<sensorData::msg> to_publish;
-            
-            for (auto it = temporary_container.begin(); it!=temporary_container.end();){
-                if (std::abs(it->timeStamp() - ref_timestamp) <= TOLLARANCE_IN_MS){
-                    to_publish.push_back(*it);
-                    it = temporary_container.erase(it);
-                }
-                else ++it;
+        // Epoch is read before polling so a push racing with the polls still wakes us
+        const uint64_t seen_epoch = sensor_notifier.epoch();
+        now_ms = window_clock_ms();
+        stageTimer timer(aggregate_stage);
+        size_t received = 0;
+        for(size_t i = 0; i < links.size(); ++i){
+            received += links[i].link->drain_into(temporary_container, AGGREGATOR_DRAIN_BATCH);
+            for(auto& msg: temporary_container){
+                const int64_t ts = msg.timeStamp();
+                merger.push(i, std::move(msg), ts, now_ms);
             }
-
-            for(auto msg: to_publish){
-                // sensorWriter.write(msg);
-                seq_counter++;
-                // Depriciated
-                // log_message(msg);
-
-                //Loggint message using spdlog into log/async_publish_log.txt
-                on_publish_log_message(msg);
-
-                // PROTOBUF CONVERSION
-                proto_msg_data.set_sensor_id(msg.sensor_id());
-                proto_msg_data.set_value(msg.value());
-                proto_msg_data.set_timestamp(msg.timeStamp());
-                proto_msg_data.set_sequence_num(msg.sequence_num());
-                // SERIALZED BUFFER CREATED 
-                std::string buffer;
-                proto_msg_data.SerializeToString(&buffer);
-                // sensorWriter.write(buffer);
-                buffer_to_dds.data().assign(buffer.begin(), buffer.end());
-                sensorWriter.write(buffer_to_dds);                
-
-                // Update dashboard state
-                {
-                    std::lock_guard<std::mutex> lock(dashboard_mutex);
-                    latest_value[msg.sensor_id()] = msg.value();
-                    latest_timestamp[msg.sensor_id()] = msg.timeStamp();
-                    latest_seq[msg.sensor_id()] = msg.sequence_num();
-                    published_count[msg.sensor_id()]++;
-                }
-                
-                msg_count++;
-                
-                // Refresh dashboard every 5 messages
-                if (msg_count % 5 == 0) {
-                    printPublisherDashboard();
-                }
+            temporary_container.clear();
+            if(links[i].stopped->load() && links[i].link->empty() && !merger.closed(i)){
+                merger.close(i);
             }
+        }
+        if(received == 0){
+            merger.expire_idle(now_ms);
+        }
 
-            std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        merger.pop_ready(to_window);
+        window_engine.flush_due(now_ms, publish_window);
+
+        if(received > 0){
+            sensor_space_notifier.notify();
+            timer.finish(received);
+        }else{
+            // Sleep until new data or the next latency deadline, whichever is first
+            const int64_t deadline_ms = std::min(window_engine.next_deadline_ms(),
+                                                 window_clock_ms() + AGGREGATOR_IDLE_WAIT.count());
+            const int64_t wait_ms = std::max<int64_t>(0, deadline_ms - window_clock_ms());
+            sensor_notifier.wait_for(seen_epoch, std::chrono::milliseconds(wait_ms));
         }
     }
+
+    // Publish whatever is still buffered before shutting down
+    merger.flush_all(to_window);
+    window_engine.flush_all(publish_window);
 }
 
 #include <string>
@@ -239,13 +633,14 @@ void aggregrator(safeQueue<sensorData::msg>& temp, safeQueue<sensorData::msg>& p
 
 // helper
 static bool all_sensors_stopped() {
-    return ctrl_switch_temp.load() && ctrl_switch_pressure.load() && ctrl_switch_flow.load();
+    return ctrl_switch_temp.load() && ctrl_switch_pressure.load() && ctrl_switch_flow.load() && ctrl_switch_load.load()
+        && replay_sources_running.load() == 0;
 }
 
 void interactive_shutdown_loop()
 {
     std::string line;
-    spdlog::info("Interactive control: (T/P/F to stop sensors, ENTER to shutdown all)");
+    spdlog::info("Interactive control: (T/P/F to stop sensors, L to stop load generation, ENTER to shutdown all)");
     while (true)
     {
         std::cout << "Command> " << std::flush;
@@ -255,8 +650,11 @@ void interactive_shutdown_loop()
             ctrl_switch_temp.store(true);
             ctrl_switch_pressure.store(true);
             ctrl_switch_flow.store(true);
+            ctrl_switch_load.store(true);
+            ctrl_switch_replay.store(true);
             std::this_thread::sleep_for(std::chrono::milliseconds(200));
             ctrl_switch_aggregator.store(true);
+            sensor_notifier.notify();
             break;
         }
 
@@ -267,8 +665,11 @@ void interactive_shutdown_loop()
             ctrl_switch_temp.store(true);
             ctrl_switch_pressure.store(true);
             ctrl_switch_flow.store(true);
+            ctrl_switch_load.store(true);
+            ctrl_switch_replay.store(true);
             std::this_thread::sleep_for(std::chrono::milliseconds(200)); // let queues drain
             ctrl_switch_aggregator.store(true);
+            sensor_notifier.notify();
             break;
         }
 
@@ -286,8 +687,12 @@ void interactive_shutdown_loop()
                 ctrl_switch_flow.store(true);
                 spdlog::info("Flow sensor stop requested");
                 break;
+            case 'L': case 'l':
+                ctrl_switch_load.store(true);
+                spdlog::info("Load generation stop requested");
+                break;
             default:
-                std::cout << "Unknown command: '" << c << "' (T,P,F or Enter)\n";
+                std::cout << "Unknown command: '" << c << "' (T,P,F,L or Enter)\n";
         }
 
         // If all producers stopped, stop aggregator automatically after small grace
@@ -295,16 +700,137 @@ void interactive_shutdown_loop()
             spdlog::info("All sensors stopped → allowing aggregator to drain then stopping it");
             std::this_thread::sleep_for(std::chrono::milliseconds(300));
             ctrl_switch_aggregator.store(true);
+            sensor_notifier.notify();
             break;
         }
     }
 }
 
 
-int32_t main() {
-    safeQueue<sensorData::msg> temp_sensor_data_queue;
-    safeQueue<sensorData::msg> pres_sensor_data_queue;
-    safeQueue<sensorData::msg> flow_sensor_data_queue;
+void print_usage(const char* program){
+    std::cout << "Usage: " << program << " [--load-gen <readings/s per thread, 0 = max>]"
+              << " [--load-threads <n>] [--load-channels <per thread>]"
+              << " [--load-values normal:<mean>:<stddev>|uniform:<lo>:<hi>|walk:<start>:<step>"
+              << "|sine:<mean>:<amplitude>:<period>:<noise>]"
+              << " [--replay <log file>]... [--replay-speed <x, 0 = max>]"
+              << " [--codec protobuf|cdr|fixed|schema] [--compress]"
+              << " [--qos-file <ini>] [--qos <profile>]\n";
+}
+
+// Returns false on an unknown or incomplete option
+bool parse_options(int argc, char* argv[], loadGenConfig& config, replayConfig& replay){
+    for(int i = 1; i < argc; ++i){
+        const std::string arg = argv[i];
+        if(arg == "--compress"){
+            frame_compression = true;
+            continue;
+        }
+        if(i + 1 >= argc) return false;
+        if(arg == "--load-gen"){
+            if(!parse_non_negative(argv[++i], config.readings_per_second)) return false;
+            if(config.threads == 0) config.threads = 1;
+        }else if(arg == "--load-threads"){
+            if(!parse_count(argv[++i], config.threads)) return false;
+        }else if(arg == "--load-channels"){
+            if(!parse_count(argv[++i], config.channels_per_thread)) return false;
+            config.channels_per_thread = std::max<size_t>(1, config.channels_per_thread);
+        }else if(arg == "--load-values"){
+            if(!parse_value_distribution(argv[++i], config.values)) return false;
+        }else if(arg == "--replay"){
+            replay.files.push_back(argv[++i]);
+        }else if(arg == "--replay-speed"){
+            if(!parse_non_negative(argv[++i], replay.speed)) return false;
+        }else if(arg == "--codec"){
+            if(!parse_frame_codec(argv[++i], frame_codec)) return false;
+        }else if(arg == "--qos-file"){
+            std::string error;
+            if(!qos_profiles.load_file(argv[++i], error)){
+                std::cerr << "===[PUBLISHER] QoS profiles : " << error << std::endl;
+                return false;
+            }
+        }else if(arg == "--qos"){
+            telemetry_qos_profile = argv[++i];
+        }else{
+            return false;
+        }
+    }
+    if(!qos_profiles.find(telemetry_qos_profile)){
+        std::cerr << "===[PUBLISHER] Unknown QoS profile " << telemetry_qos_profile << std::endl;
+        return false;
+    }
+    // Gorilla blocks are a protobuf frame field
+    return !frame_compression || frame_codec == frameCodec::Protobuf;
+}
+
+int32_t main(int argc, char* argv[]) {
+    loadGenConfig load_config;
+    replayConfig replay_config;
+    if(!parse_options(argc, argv, load_config, replay_config)){
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    // Replay files are mapped up front; a pass over each finds its sensors and first timestamp
+    std::vector<mappedFile> replay_files;
+    std::set<std::string> replay_sensors;
+    int64_t replay_first_ts = std::numeric_limits<int64_t>::max();
+    try{
+        for(const auto& path: replay_config.files){
+            replay_files.emplace_back(path);
+            replayReader reader(replay_files.back().view());
+            replayRecord rec;
+            bool first = true;
+            while(reader.next(rec)){
+                if(first) replay_first_ts = std::min(replay_first_ts, rec.timestamp);
+                first = false;
+                replay_sensors.emplace(rec.sensor_id);
+            }
+        }
+    }catch(const std::system_error& e){
+        std::cerr << "===[PUBLISHER] Replay file error : " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    sensor_link temp_sensor_data_queue(SENSOR_LINK_CAPACITY);
+    sensor_link pres_sensor_data_queue(SENSOR_LINK_CAPACITY);
+    sensor_link flow_sensor_data_queue(SENSOR_LINK_CAPACITY);
+    temp_sensor_data_queue.attach_notifier(&sensor_notifier);
+    pres_sensor_data_queue.attach_notifier(&sensor_notifier);
+    flow_sensor_data_queue.attach_notifier(&sensor_notifier);
+    sensor_links = {{"Temp-Sensor", &temp_sensor_data_queue, &ctrl_switch_temp},
+                    {"Press-Sensor", &pres_sensor_data_queue, &ctrl_switch_pressure},
+                    {"flow-Sensor", &flow_sensor_data_queue, &ctrl_switch_flow}};
+    for(const auto& info: sensor_links){
+        channel_registry.intern(info.name);
+    }
+
+    std::vector<std::unique_ptr<sensor_link>> load_links;
+    std::vector<uint32_t> load_first_channel;
+    for(size_t t = 0; t < load_config.threads; ++t){
+        load_links.push_back(std::make_unique<sensor_link>(SENSOR_LINK_CAPACITY));
+        load_links.back()->attach_notifier(&sensor_notifier);
+        sensor_links.push_back({"Load-" + std::to_string(t), load_links.back().get(), &ctrl_switch_load});
+        load_first_channel.push_back(static_cast<uint32_t>(channel_registry.size()));
+        for(size_t c = 0; c < load_config.channels_per_thread; ++c){
+            channel_registry.intern(load_channel_name(t, c));
+        }
+    }
+    // Without load generation there is nothing to stop
+    if(load_config.threads == 0) ctrl_switch_load.store(true);
+
+    std::vector<std::unique_ptr<sensor_link>> replay_links;
+    std::vector<std::unique_ptr<std::atomic<bool>>> replay_done;
+    for(size_t f = 0; f < replay_files.size(); ++f){
+        replay_links.push_back(std::make_unique<sensor_link>(SENSOR_LINK_CAPACITY));
+        replay_links.back()->attach_notifier(&sensor_notifier);
+        replay_done.push_back(std::make_unique<std::atomic<bool>>(false));
+        sensor_links.push_back({"Replay-" + std::to_string(f), replay_links.back().get(), replay_done.back().get()});
+    }
+    for(const auto& name: replay_sensors){
+        channel_registry.intern(name);
+    }
+    dashboard_channels.resize(channel_registry.size());
+    replay_sources_running.store(replay_files.size());
     
     // Initializing logging 
     init_logging();
@@ -312,24 +838,76 @@ int32_t main() {
     try{
         // DDS Setup
         dds::domain::DomainParticipant pub_participent_entity(domain::default_id());
-        dds::topic::Topic<SensorData::RawSensorData> sensorTelemetyTopic(pub_participent_entity, "SENSOR-TELEMETRY");
+        dds::topic::Topic<SensorData::ChannelFrame> sensorTelemetyTopic(pub_participent_entity, "SENSOR-TELEMETRY");
         dds::pub::Publisher publisher_entity(pub_participent_entity);
         
-        // Create QoS for best-effort streaming data
-        // dds::pub::qos::DataWriterQos besteffort_sensor_qos;
-        // besteffort_sensor_qos << dds::core::policy::Reliability::BestEffort() << dds::core::policy::History::KeepLast(1) << dds::core::policy::Durability::Volatile();
-        dds::pub::qos::DataWriterQos reliable_sensor_qos;
-        reliable_sensor_qos << dds::core::policy::Reliability::Reliable() << dds::core::policy::History::KeepLast(10) << dds::core::policy::Durability::TransientLocal() << dds::core::policy::Deadline(dds::core::Duration::from_millisecs(1000));
+        // History and deadline apply per channel: the topic is keyed
+        const qosProfile& telemetry_profile = *qos_profiles.find(telemetry_qos_profile);
+        const auto telemetry_qos = make_dds_qos<dds::pub::qos::DataWriterQos>(telemetry_profile);
         
         std::cout<<"===[PUBLISHER] Successfully created Publisher Entity"<<std::endl;
-        dds::pub::DataWriter<SensorData::RawSensorData> sensorWriterObj(publisher_entity, sensorTelemetyTopic);
+        dds::pub::DataWriter<SensorData::ChannelFrame> sensorWriterObj(publisher_entity, sensorTelemetyTopic, telemetry_qos);
+        std::cout<<"===[PUBLISHER] Telemetry QoS profile " << telemetry_profile.name << std::endl;
         std::cout<<"===[PUBLISHER] Writer created" << std::endl;
-        std::cout<<"===[PUBLISHER] STARTED"<<std::endl;
 
-        std::thread temp_thread(temp_sensor_data, std::ref(temp_sensor_data_queue), 20.0, 100.0);
-        std::thread pres_thread(press_sensor_data, std::ref(pres_sensor_data_queue), 220.0, 350.0);
-        std::thread flow_thread(flow_sensor_data, std::ref(flow_sensor_data_queue), 500.0, 1000.0);
-        std::thread sensor_thread(aggregrator, std::ref(temp_sensor_data_queue), std::ref(pres_sensor_data_queue), std::ref(flow_sensor_data_queue), std::ref(sensorWriterObj));
+        // Channel dictionary: written once, kept by the writer for late-joining readers
+        dds::topic::Topic<SensorData::ChannelDictionary> channelTopic(pub_participent_entity, "SENSOR-CHANNELS");
+        const auto dictionary_qos = make_dds_qos<dds::pub::qos::DataWriterQos>(
+            *qos_profiles.find(qosProfileSet::CHANNEL_DICTIONARY));
+        dds::pub::DataWriter<SensorData::ChannelDictionary> channelWriter(publisher_entity, channelTopic, dictionary_qos);
+        SensorData::ChannelDictionary dictionary;
+        for(uint32_t id = 0; id < channel_registry.size(); ++id){
+            SensorData::ChannelName entry;
+            entry.channel(id);
+            entry.name(channel_registry.name(id));
+            dictionary.channels().push_back(entry);
+        }
+        channelWriter.write(dictionary);
+        std::cout<<"===[PUBLISHER] Channel dictionary published (" << channel_registry.size() << " channels)" << std::endl;
+        std::cout<<"===[PUBLISHER] STARTED (codec " << frame_codec_name(frame_codec) << (frame_compression ? ", compressed" : "") << ")"<<std::endl;
+
+        std::vector<simulatedSensor> sensors;
+        sensors.reserve(sensor_links.size());
+        sensors.push_back({"Temp-Sensor", channel_registry.intern("Temp-Sensor"), 20.0, 100.0, SENSOR_PERIOD, &temp_sensor_data_queue, &ctrl_switch_temp, &temp_seq_counter});
+        sensors.push_back({"Press-Sensor", channel_registry.intern("Press-Sensor"), 220.0, 350.0, SENSOR_PERIOD, &pres_sensor_data_queue, &ctrl_switch_pressure, &pres_seq_counter});
+        sensors.push_back({"flow-Sensor", channel_registry.intern("flow-Sensor"), 500.0, 1000.0, SENSOR_PERIOD, &flow_sensor_data_queue, &ctrl_switch_flow, &flow_seq_counter});
+        // Channel ids follow sensor_links order, which the dashboard relies on
+        for(size_t i = 0; i < sensors.size(); ++i){
+            simulatedSensor& sensor = sensors[i];
+            const int64_t period_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(sensor.period).count();
+            sensor_scheduler.add_channel(period_ns, [&sensor](int64_t){ return sample_sensor(sensor); }, i);
+        }
+        sensor_scheduler.start();
+        std::vector<std::thread> load_threads;
+        for(size_t t = 0; t < load_config.threads; ++t){
+            load_threads.emplace_back(load_generator, t, std::cref(load_config), load_first_channel[t], std::ref(*load_links[t]));
+        }
+        std::vector<std::thread> replay_threads;
+        const auto replay_start = std::chrono::steady_clock::now();
+        for(size_t f = 0; f < replay_files.size(); ++f){
+            replay_threads.emplace_back(replay_source, std::cref(replay_files[f]), std::ref(*replay_links[f]),
+                                        replay_config.speed, replay_first_ts, replay_start, std::ref(*replay_done[f]));
+        }
+        // Encode workers, one encode state and one link to the writer each, sharded by sensor
+        const size_t encode_workers = ENCODE_WORKERS ? ENCODE_WORKERS : std::max(1u, std::thread::hardware_concurrency());
+        std::vector<encodeState> encode_states(encode_workers);
+        encode_sequencer = std::make_unique<channelSequencer>(channel_registry.size());
+        for(size_t i = 0; i < encode_workers; ++i){
+            encoded_links.push_back(std::make_unique<encoded_link>(ENCODED_LINK_CAPACITY));
+            encoded_links.back()->attach_notifier(&encoded_notifier);
+        }
+        encode_pool encoders(encode_workers, [&](size_t worker, size_t channel, std::vector<sensorData::msg>& batch){
+            encode_batch(static_cast<uint32_t>(channel), batch, encode_states[worker], *encoded_links[worker]);
+        });
+        // One pool channel per registry id, added in id order
+        for(const auto& name: channel_registry.names()){
+            encoders.add_channel(std::hash<std::string>{}(name));
+        }
+
+        std::thread writer_thread(writer, std::ref(sensorWriterObj));
+        encoders.start();
+        std::thread sensor_thread(aggregrator, std::cref(sensor_links), std::ref(encoders));
+        std::thread dashboard_thread(dashboard_loop);
 
 
         // Shutdown 
@@ -341,13 +919,21 @@ int32_t main() {
         std::cout << "Press T to stop temperature sensor\n";
         std::cout << "Press P to stop temperature sensor\n";
         std::cout << "Press F to stop temperature sensor\n";
+        if(load_config.threads > 0) std::cout << "Press L to stop load generation\n";
         interactive_shutdown_loop();
 
         std::cout<<"\n===[PUBLISHER] STOPPED"<<std::endl;
-        temp_thread.join();
-        pres_thread.join();
-        flow_thread.join();
+        sensor_scheduler.stop();
+        for(auto& t: load_threads) t.join();
+        for(auto& t: replay_threads) t.join();
+        // Stages shut down front to back, each after its input has drained
         sensor_thread.join();
+        encoders.stop();
+        ctrl_switch_writer.store(true);
+        encoded_notifier.notify();
+        writer_thread.join();
+        ctrl_switch_dashboard.store(true);
+        dashboard_thread.join();
 
     }catch (const dds::core::Exception& ce){
         std::cerr << "===[PUBLISHER] Exception : " << ce.what() <<std::endl;
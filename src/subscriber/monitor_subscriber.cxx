@@ -1,41 +1,127 @@
 #include <iostream>
+#include <algorithm>
 #include <chrono>
 #include <thread>
 #include <atomic>
 #include <fstream>
-#include <numeric>
 #include <iomanip>
-#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
 #include <vector>
 #include "utilities/safe_queue.h"
+#include "utilities/spsc_ring_buffer.h"
+#include "utilities/queue_notifier.h"
+#include "utilities/sharded_aggregator.h"
+#include "utilities/channel_sequencer.h"
+#include "utilities/stage_metrics.h"
+#include "utilities/dds_qos.h"
+#include "utilities/option_values.h"
+#include "utilities/latency_histogram.h"
 #include "dds/dds.hpp"
 #include "spdlog/spdlog.h"
 #include "spdlog/async.h"
 #include "spdlog/sinks/rotating_file_sink.h"
 #include "message_schema.hpp"
 #include "Serializer/sensor.pb.h"
+#include "Serializer/frame_decoder.h"
 #include "Sensor_wrapper.hpp"
 
 using namespace org::eclipse::cyclonedds;
 
 std::atomic<bool> ctrl_switch{false};
+std::atomic<bool> ctrl_switch_stats{false};
+std::atomic<bool> ctrl_switch_dashboard{false};
 std::mutex log_mutex;
 
-struct RECIVED_DATA : sensorData::msg{ 
+// The receive loop sleeps in a WaitSet until a reader has unread samples or shutdown
+// is requested. Each wakeup takes at most --take-batch frames.
+const size_t DEFAULT_TAKE_BATCH = 256;
+const auto WAITSET_TIMEOUT = std::chrono::seconds(1);
+
+// How the receive loop is doing: wakeups, frames per wakeup, and how long frames sat
+// between their write (source timestamp) and the wakeup that took them, in us.
+// The receive thread records a whole wakeup's frames under one lock; the dashboard
+// takes the lock once per refresh.
+struct wakeStats {
+    std::atomic<uint64_t> wakeups{0};
+    std::atomic<uint64_t> timeouts{0};
+    std::atomic<uint64_t> frames{0};
+    mutable std::mutex latency_mutex;
+    latencyHistogram latency;
+
+    latencySummary latency_summary() const {
+        std::lock_guard<std::mutex> lock(latency_mutex);
+        return latency.summary();
+    }
+};
+
+// Pipeline stages, each on its own thread (decode on a pool):
+//   receive   (WaitSet loop: takes frames, hands them to the decode pool)
+//   decode    (frameDecoder + logging, frames sharded by channel key)
+//   stats     (single writer of the per-sensor monitor state)
+//   dashboard (renders the latest stats snapshot)
+// A channel always maps to the same pool channel, so each sensor's frames are
+// decoded in order; decode_sequencer keeps that order across the workers' links
+// into the stats stage. 0 decode workers means one per core.
+const size_t DECODE_WORKERS = 0;
+const size_t DECODE_POOL_CHANNELS = 64;
+
+// A frame as taken from the reader, on its way to a decode worker. Filled in place
+// in the pool link, so the payload buffer is reused from one frame to the next.
+struct receivedFrame {
+    uint32_t channel = 0;
+    uint64_t received_ms = 0;
+    std::vector<uint8_t> bytes;
+};
+using decode_pool = shardedAggregator<receivedFrame>;
+
+// A decoded frame on its way to the stats stage. Link slots are filled in place,
+// so the records vector keeps its capacity from one frame to the next.
+struct decodedFrame {
+    uint32_t channel = 0;
+    uint64_t received_ms = 0;
+    size_t pool_channel = 0;
+    uint64_t stamp = 0;   // decode_sequencer number within the pool channel
+    std::vector<sensorRecord> records;
+};
+using decoded_link = spscRingBuffer<decodedFrame>;
+const size_t DECODED_LINK_CAPACITY = 4096;
+queueNotifier decoded_notifier;
+const auto STATS_IDLE_WAIT = std::chrono::milliseconds(100);
+const size_t STATS_DRAIN_BATCH = 256;
+std::vector<std::unique_ptr<decoded_link>> decoded_links;
+channelSequencer decode_sequencer(DECODE_POOL_CHANNELS);
+
+// Frames carry channel ids; anything beyond this is a corrupt key
+const uint32_t MAX_MONITORED_CHANNELS = 1u << 20;
+
+const auto DASHBOARD_REFRESH = std::chrono::milliseconds(500);
+
+// Latency percentiles cover every reading since start unless --latency-window
+// narrows them to the last second or minute
+const int64_t LATENCY_WINDOW_ALL = 0;
+
+stageMetrics receive_stage;
+stageMetrics decode_stage;
+stageMetrics stats_stage;
+
+struct RECIVED_DATA { 
+    sensorRecord record;
     uint64_t revive_time; 
 };
 
 
 // LOGGING - SECTION
 //Depriciated
-void log_message(const RECIVED_DATA& data){
+void log_message(const RECIVED_DATA& data, const std::string& sensor_id){
     std::ofstream logFile("Subscriber-Log.csv", std::ios::app);
     std::lock_guard<std::mutex> lock(log_mutex);    
-    logFile << data.sensor_id() << " "
-            << data.value() << " "
-            << data.timeStamp() << " "
+    logFile << sensor_id << " "
+            << data.record.value << " "
+            << data.record.timestamp << " "
             << data.revive_time << " "
-            << data.sequence_num() << "\n";        
+            << data.record.sequence_num << "\n";        
 }
 
 void init_logging(){
@@ -59,28 +145,77 @@ void init_logging(){
 }
 
 
-void on_recived_log_message(const RECIVED_DATA& data){
-    spdlog::info("PUB sensor={} value={} ts={} rs={} seq={}", data.sensor_id(), data.value(), data.timeStamp(), data.revive_time, data.sequence_num());  ;
+void on_recived_log_message(const RECIVED_DATA& data, const std::string& sensor_id){
+    spdlog::info("PUB sensor={} value={} ts={} rs={} seq={}", sensor_id, data.record.value, data.record.timestamp, data.revive_time, data.record.sequence_num);  ;
 }
 
 
 int64_t latency(const RECIVED_DATA& data){
-    return static_cast<int64_t>(data.revive_time) - static_cast<int64_t>(data.timeStamp());
+    return static_cast<int64_t>(data.revive_time) - data.record.timestamp;
 }
 
 void clearScreen() {
     std::cout << "\033[2J\033[1;1H"; // ANSI escape codes
 }
 
-void printDashboard(
-    const std::map<std::string, int32_t>& total_received,
-    const std::map<std::string, int32_t>& total_expected,
-    const std::map<std::string, int32_t>& gaps_detected,
-    const std::map<std::string, std::vector<int64_t>>& latency_sensor,
-    const std::map<std::string, double>& latest_value,
-    const std::map<std::string, uint64_t>& latest_seq,
-    const std::map<std::string, int64_t>& latest_lat
-) {
+// Channel names from the dictionary topic. The receive thread defines them; decode
+// workers copy them into their own decoder whenever the version moves, and the
+// dashboard reads them directly.
+class channelNames {
+private:
+    mutable std::mutex m_mutex;
+    std::vector<std::string> m_names;   // by channel id, empty until named
+    std::atomic<uint64_t> m_version{0};
+
+public:
+    void define(uint32_t channel, const std::string& name){
+        if(channel >= MAX_MONITORED_CHANNELS) return;
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if(channel >= m_names.size()) m_names.resize(channel + 1);
+        m_names[channel] = name;
+        m_version.fetch_add(1, std::memory_order_release);
+    }
+
+    uint64_t version() const { return m_version.load(std::memory_order_acquire); }
+
+    // Returns the version applied
+    uint64_t apply_to(frameDecoder& decoder) const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for(uint32_t channel = 0; channel < m_names.size(); ++channel){
+            if(!m_names[channel].empty()) decoder.define_channel(channel, m_names[channel]);
+        }
+        return m_version.load(std::memory_order_acquire);
+    }
+
+    std::string name(uint32_t channel) const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if(channel < m_names.size() && !m_names[channel].empty()) return m_names[channel];
+        return "channel-" + std::to_string(channel);
+    }
+};
+channelNames channel_names;
+
+// Per-sensor monitor state, indexed by channel id. Only the stats stage writes it;
+// the dashboard renders a copy taken every DASHBOARD_REFRESH.
+struct sensorMonitor {
+    bool seen = false;
+    int64_t last_seq = 0;
+    int32_t received = 0;
+    int32_t expected = 0;
+    int32_t gaps = 0;
+    int32_t duplicates = 0;     // readings at or behind the last sequence number
+    latencySummary latency;     // filled when the snapshot is taken
+    double latest_value = 0.0;
+    uint64_t latest_seq = 0;
+    int64_t latest_lat = 0;
+};
+std::mutex snapshot_mutex;
+std::vector<sensorMonitor> monitor_snapshot;
+latencySummary monitor_overall_latency;
+int64_t monitor_latency_window_ms = LATENCY_WINDOW_ALL;
+
+void printDashboard(const std::vector<sensorMonitor>& sensors, const latencySummary& overall_latency,
+                    int64_t latency_window_ms, const wakeStats& wake, const decode_pool& decoders) {
     clearScreen();
     
     std::cout << "\n======================== TELEMETRY MONITOR DASHBOARD ========================\n\n";
@@ -88,151 +223,508 @@ void printDashboard(
               << std::setw(15) << "Sensor"
               << std::setw(12) << "Value"
               << std::setw(8) << "Seq"
-              << std::setw(12) << "Lat(ms)"
-              << std::setw(12) << "Avg Lat"
-              << std::setw(12) << "Loss %"
+              << std::setw(10) << "Lat(ms)"
+              << std::setw(8) << "p50"
+              << std::setw(8) << "p90"
+              << std::setw(8) << "p99"
+              << std::setw(8) << "p99.9"
+              << std::setw(8) << "Max"
+              << std::setw(10) << "Loss %"
               << std::setw(15) << "Recv/Exp" << "\n";
-    std::cout << std::string(90, '-') << "\n";
+    std::cout << std::string(110, '-') << "\n";
     
-    for (const auto& [sensor, recv] : total_received) {
-        double avg_lat = 0.0;
-        if (latency_sensor.count(sensor) && !latency_sensor.at(sensor).empty()) {
-            const auto& lats = latency_sensor.at(sensor);
-            avg_lat = std::accumulate(lats.begin(), lats.end(), 0.0) / lats.size();
-        }
-        
-        int32_t expected = total_expected.count(sensor) ? total_expected.at(sensor) : 0;
-        int32_t gaps = gaps_detected.count(sensor) ? gaps_detected.at(sensor) : 0;
-        double loss_rate = (expected > 0) ? (gaps * 100.0) / expected : 0.0;
-        
-        double value = latest_value.count(sensor) ? latest_value.at(sensor) : 0.0;
-        uint64_t seq = latest_seq.count(sensor) ? latest_seq.at(sensor) : 0;
-        int64_t lat = latest_lat.count(sensor) ? latest_lat.at(sensor) : 0;
+    // Overall stats
+    int32_t total_gaps = 0, total_recv = 0, total_exp = 0, total_dups = 0;
+    for (uint32_t channel = 0; channel < sensors.size(); ++channel) {
+        const sensorMonitor& sensor = sensors[channel];
+        if (!sensor.seen) continue;
+        double loss_rate = (sensor.expected > 0) ? (sensor.gaps * 100.0) / sensor.expected : 0.0;
         
         std::cout << std::left 
-                  << std::setw(15) << sensor
-                  << std::setw(12) << std::fixed << std::setprecision(2) << value
-                  << std::setw(8) << seq
-                  << std::setw(12) << lat
-                  << std::setw(12) << std::fixed << std::setprecision(2) << avg_lat
-                  << std::setw(12) << std::fixed << std::setprecision(2) << loss_rate
-                  << recv << "/" << expected << "\n";
-    }
-    
-    // Overall stats
-    int32_t total_gaps = 0, total_recv = 0, total_exp = 0;
-    for (const auto& [id, _] : total_received) {
-        total_gaps += gaps_detected.count(id) ? gaps_detected.at(id) : 0;
-        total_recv += total_received.at(id);
-        total_exp += total_expected.count(id) ? total_expected.at(id) : 0;
+                  << std::setw(15) << channel_names.name(channel)
+                  << std::setw(12) << std::fixed << std::setprecision(2) << sensor.latest_value
+                  << std::setw(8) << sensor.latest_seq
+                  << std::setw(10) << sensor.latest_lat
+                  << std::setw(8) << sensor.latency.p50
+                  << std::setw(8) << sensor.latency.p90
+                  << std::setw(8) << sensor.latency.p99
+                  << std::setw(8) << sensor.latency.p999
+                  << std::setw(8) << sensor.latency.max
+                  << std::setw(10) << std::fixed << std::setprecision(2) << loss_rate
+                  << sensor.received << "/" << sensor.expected << "\n";
+
+        total_gaps += sensor.gaps;
+        total_dups += sensor.duplicates;
+        total_recv += sensor.received;
+        total_exp += sensor.expected;
     }
     double overall_loss = (total_exp > 0) ? (total_gaps * 100.0) / total_exp : 0.0;
     
-    std::cout << "\n" << std::string(90, '=') << "\n";
+    std::cout << "\n" << std::string(110, '=') << "\n";
     std::cout << "OVERALL: Received: " << total_recv 
               << " | Expected: " << total_exp
               << " | Lost: " << total_gaps
+              << " | Duplicates: " << total_dups
               << " | Loss Rate: " << std::fixed << std::setprecision(2) << overall_loss << "%\n";
-    std::cout << std::string(90, '=') << "\n";
+    std::cout << "LATENCY(ms, " << (latency_window_ms == LATENCY_WINDOW_ALL ? std::string("all")
+                                    : "last " + std::to_string(latency_window_ms / 1000) + "s") << "): "
+              << "p50 " << overall_latency.p50
+              << " | p90 " << overall_latency.p90
+              << " | p99 " << overall_latency.p99
+              << " | p99.9 " << overall_latency.p999
+              << " | max " << overall_latency.max
+              << " | mean " << std::fixed << std::setprecision(2) << overall_latency.mean << "\n";
+    const latencySummary wake_latency = wake.latency_summary();
+    const uint64_t wakeups = wake.wakeups.load();
+    std::cout << "WAKEUPS: " << wakeups
+              << " | Idle timeouts: " << wake.timeouts.load()
+              << " | Frames/wake: " << std::fixed << std::setprecision(1)
+              << (wakeups ? static_cast<double>(wake.frames.load()) / wakeups : 0.0)
+              << " | Wake lat p50/p99/max(us): " << wake_latency.p50
+              << "/" << wake_latency.p99 << "/" << wake_latency.max << "\n";
+    std::cout << std::string(110, '=') << "\n";
+
+    // Queue depths: decode pool input summed over its channels, stats input over the workers' links
+    size_t decode_depth = 0, decode_hwm = 0, stats_depth = 0, stats_hwm = 0;
+    for (size_t i = 0; i < decoders.channel_count(); ++i) {
+        const queueStatsSnapshot stats = decoders.channel_stats(i);
+        decode_depth += stats.pushed - stats.popped;
+        decode_hwm = std::max<size_t>(decode_hwm, stats.high_water);
+    }
+    for (const auto& link : decoded_links) {
+        stats_depth += link->size();
+        stats_hwm = std::max<size_t>(stats_hwm, link->stats().high_water);
+    }
+
+    std::cout << "\n" << std::left
+              << std::setw(15) << "Stage"
+              << std::setw(12) << "Items"
+              << std::setw(14) << "AvgSvc(us)"
+              << std::setw(14) << "MaxBatch(us)"
+              << std::setw(15) << "InDepth/HWM" << "\n";
+    std::cout << std::string(70, '-') << "\n";
+    auto print_stage = [](const char* name, const stageMetrics& metrics, const std::string& queue){
+        const stageMetricsSnapshot s = metrics.snapshot();
+        std::cout << std::left
+                  << std::setw(15) << name
+                  << std::setw(12) << s.items
+                  << std::setw(14) << std::fixed << std::setprecision(1) << s.avg_item_ns / 1000.0
+                  << std::setw(14) << s.max_batch_ns / 1000
+                  << std::setw(15) << queue << "\n";
+    };
+    print_stage("receive", receive_stage, "-");
+    print_stage("decode", decode_stage, std::to_string(decode_depth) + "/" + std::to_string(decode_hwm));
+    print_stage("stats", stats_stage, std::to_string(stats_depth) + "/" + std::to_string(stats_hwm));
+}
+
+void dashboard_loop(const wakeStats& wake, const decode_pool& decoders){
+    std::vector<sensorMonitor> sensors;
+    latencySummary overall_latency;
+    int64_t latency_window_ms = LATENCY_WINDOW_ALL;
+    while (!ctrl_switch_dashboard){
+        {
+            std::lock_guard<std::mutex> lock(snapshot_mutex);
+            sensors = monitor_snapshot;
+            overall_latency = monitor_overall_latency;
+            latency_window_ms = monitor_latency_window_ms;
+        }
+        printDashboard(sensors, overall_latency, latency_window_ms, wake, decoders);
+        std::this_thread::sleep_for(DASHBOARD_REFRESH);
+    }
 }
 
-// Desrialing data reviced
-sensorData::msg on_data_recived(const SensorData::RawSensorData& raw_data_message){
-    sensor_proto::proto_serial_data proto_msg;
-    sensorData::msg temporary_data;
-    std::string buffer(raw_data_message.data().begin(), raw_data_message.data().end());
-    if(!proto_msg.ParseFromString(buffer)){
+// Desrialing data reviced: every DDS sample is a frame of readings. The frame is
+// parsed in place from the received bytes into reused records.
+bool on_data_recived(const receivedFrame& frame, frameDecoder& decoder, std::vector<sensorRecord>& records){
+    if(!decoder.decode(frame.bytes.data(), frame.bytes.size(), records)){
         std::cerr << " Failed to Deserialze the buffer \n";
-        return temporary_data;
-    }
-    temporary_data.sensor_id(proto_msg.sensor_id());
-    temporary_data.sequence_num(proto_msg.sequence_num());
-    temporary_data.value(proto_msg.value());
-    temporary_data.timeStamp(proto_msg.timestamp());
-
-    // returnig final sensorData::msg 
-    return temporary_data;
-}   
-
-int32_t main(){
-    std::map<std::string, int32_t> seq_map; 
-    std::map<std::string, int32_t> total_received_sensor;
-    std::map<std::string, int32_t> total_expected_sensor;
-    std::map<std::string, int32_t> gaps_detected;
-    std::map<std::string, std::vector<int64_t>> latency_sensor;
-    std::map<std::string, double> latest_value;
-    std::map<std::string, uint64_t> latest_seq;
-    std::map<std::string, int64_t> latest_lat;
+        return false;
+    }
+    return true;
+}
+
+// Decode state reused across frames; one per decode worker
+struct decodeState {
+    frameDecoder decoder;
+    uint64_t names_version = 0;
+    std::vector<sensorRecord> records;
+
+    explicit decodeState(frameCodec codec) : decoder(codec) {}
+};
+
+// Decode stage: parses and logs a batch of one pool channel's frames and hands the
+// records to the stats stage, stamped so it can take them in pool channel order
+void decode_batch(size_t pool_channel, std::vector<receivedFrame>& batch, decodeState& state, decoded_link& out){
+    stageTimer timer(decode_stage);
+    if(state.names_version != channel_names.version()){
+        state.names_version = channel_names.apply_to(state.decoder);
+    }
+    size_t records = 0;
+    for(const receivedFrame& frame: batch){
+        // Converting raw into mangable data
+        if(!on_data_recived(frame, state.decoder, state.records)) continue;
+
+        for(const sensorRecord& record: state.records){
+            // logging final data
+            // Depriciated
+            // log_message(data, sensor_id);
+            on_recived_log_message(RECIVED_DATA{record, frame.received_ms}, state.decoder.name(record.sensor));
+        }
+        records += state.records.size();
+
+        // Back-pressure: wait for the stats stage rather than dropping
+        auto fill = [&](decodedFrame& slot){
+            slot.channel = frame.channel;
+            slot.received_ms = frame.received_ms;
+            slot.pool_channel = pool_channel;
+            slot.stamp = decode_sequencer.next(pool_channel);
+            slot.records.swap(state.records);
+        };
+        while(!out.push_with(fill)){
+            std::this_thread::yield();
+        }
+    }
+    timer.finish(records);
+}
+
+// Latency of one sensor in fixed memory: every reading since start, and the last
+// window_ms when a window is set
+struct sensorLatency {
+    latencyHistogram all;
+    std::unique_ptr<windowedLatencyHistogram> window;
+};
+
+int64_t steady_ms(){
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Stats stage: the only writer of the monitor state. Readings are attributed to
+// their frame's channel key; a copy goes to the dashboard every DASHBOARD_REFRESH.
+void monitor_stats(int64_t latency_window_ms){
+    std::vector<sensorMonitor> sensors;
+    std::vector<sensorLatency> latencies;
+    size_t records_seen = 0;
+    auto on_frame = [&](decodedFrame& frame){
+        if(frame.channel >= MAX_MONITORED_CHANNELS) return;
+        if(frame.channel >= sensors.size()){
+            sensors.resize(frame.channel + 1);
+            latencies.resize(frame.channel + 1);
+        }
+        sensorMonitor& sensor = sensors[frame.channel];
+        sensorLatency& sensor_latency = latencies[frame.channel];
+        if(latency_window_ms != LATENCY_WINDOW_ALL && !sensor_latency.window){
+            sensor_latency.window = std::make_unique<windowedLatencyHistogram>(latency_window_ms);
+        }
+        const int64_t now_ms = steady_ms();
+        records_seen += frame.records.size();
+
+        for(const sensorRecord& record: frame.records){
+            RECIVED_DATA data{record, frame.received_ms};
+            int64_t current_seq = record.sequence_num;
+            int64_t lat = latency(data);
+
+            sensor_latency.all.record(lat);
+            if(sensor_latency.window) sensor_latency.window->record(lat, now_ms);
+            sensor.received++;
+
+            // Gap detection
+            if(sensor.seen){
+                // Frames arrive in order (decode_sequencer), so anything at or behind
+                // the last sequence number is a duplicate or replay, not a late reading
+                if(current_seq <= sensor.last_seq){
+                    sensor.duplicates++;
+                    continue;
+                }
+                int64_t expected = sensor.last_seq + 1;
+                if(current_seq != expected){
+                    int32_t gap_size = current_seq - expected;
+                    sensor.gaps += gap_size;
+                }
+                sensor.expected += current_seq - sensor.last_seq;
+            } else {
+                sensor.expected = 1;
+                sensor.seen = true;
+            }
+            sensor.last_seq = current_seq;
+            sensor.latest_value = record.value;
+            sensor.latest_seq = current_seq;
+            sensor.latest_lat = lat;
+        }
+    };
+    // Summaries are taken here rather than per reading; the overall one merges
+    // every sensor's histogram
+    latencyHistogram overall, window_view;
+    auto publish_snapshot = [&]{
+        const int64_t now_ms = steady_ms();
+        overall.reset();
+        for(size_t channel = 0; channel < sensors.size(); ++channel){
+            const sensorLatency& sensor_latency = latencies[channel];
+            const latencyHistogram* view = &sensor_latency.all;
+            if(sensor_latency.window){
+                window_view.reset();
+                sensor_latency.window->merge_into(window_view, now_ms);
+                view = &window_view;
+            }
+            sensors[channel].latency = view->summary();
+            overall.merge(*view);
+        }
+        const latencySummary overall_latency = overall.summary();
+        std::lock_guard<std::mutex> lock(snapshot_mutex);
+        monitor_snapshot = sensors;
+        monitor_overall_latency = overall_latency;
+        monitor_latency_window_ms = latency_window_ms;
+    };
+
+    auto order_of = [](const decodedFrame& frame){
+        return std::pair<size_t, uint64_t>{frame.pool_channel, frame.stamp};
+    };
+
+    auto last_snapshot = std::chrono::steady_clock::now();
+    while(true){
+        const uint64_t seen_epoch = decoded_notifier.epoch();
+        stageTimer timer(stats_stage);
+        records_seen = 0;
+        bool waiting = false;
+        const size_t consumed = decode_sequencer.drain(decoded_links, STATS_DRAIN_BATCH, order_of, on_frame, waiting);
+        if(consumed > 0) timer.finish(records_seen);
+
+        const auto now = std::chrono::steady_clock::now();
+        if(now - last_snapshot >= DASHBOARD_REFRESH){
+            publish_snapshot();
+            last_snapshot = now;
+        }
+        // A frame's predecessor is in a link already passed over; it is there by now
+        if(consumed > 0 || waiting) continue;
+        // Stopped only after the decode pool has drained, so nothing is left behind
+        if(ctrl_switch_stats) break;
+        decoded_notifier.wait_for(seen_epoch, STATS_IDLE_WAIT);
+    }
+    publish_snapshot();
+}
+
+// A channel picked with --channel. Its instance handle is only known once the
+// dictionary has named it and the reader has seen one of its frames.
+struct selectedChannel {
+    std::string name;
+    bool named = false;
+    SensorData::ChannelFrame key;
+    dds::core::InstanceHandle instance = dds::core::InstanceHandle::nil();
+};
+
+// Names the channel ids that frames carry. The dictionary topic is durable, so a
+// subscriber started after the publisher still gets it.
+void on_channel_dictionary(const SensorData::ChannelDictionary& dictionary, std::vector<selectedChannel>& selected){
+    for(const auto& entry: dictionary.channels()){
+        channel_names.define(entry.channel(), entry.name());
+        for(selectedChannel& channel: selected){
+            if(channel.name != entry.name()) continue;
+            channel.key.channel(entry.channel());
+            channel.named = true;
+        }
+    }
+}
+
+bool parse_latency_window(const std::string& name, int64_t& window_ms){
+    if(name == "all") window_ms = LATENCY_WINDOW_ALL;
+    else if(name == "1s") window_ms = 1000;
+    else if(name == "1m") window_ms = 60 * 1000;
+    else return false;
+    return true;
+}
+
+void print_usage(const char* program){
+    std::cout << "Usage: " << program << " [--codec protobuf|cdr|fixed|schema] [--channel <name>]..."
+              << " [--qos-file <ini>] [--qos <profile>] [--take-batch <frames>]"
+              << " [--latency-window all|1s|1m]\n";
+}
+
+int32_t main(int argc, char* argv[]){
+    // Must match the publisher's --codec
+    frameCodec codec = frameCodec::Protobuf;
+    // Without --channel every channel is taken
+    std::vector<selectedChannel> selected;
+    // Must match the publisher's --qos
+    qosProfileSet qos_profiles;
+    std::string telemetry_qos_profile = qosProfileSet::LATE_JOIN_SNAPSHOT;
+    std::string qos_error;
+    size_t take_batch = DEFAULT_TAKE_BATCH;
+    int64_t latency_window_ms = LATENCY_WINDOW_ALL;
+    for(int i = 1; i < argc; ++i){
+        const std::string arg = argv[i];
+        if(arg == "--codec" && i + 1 < argc && parse_frame_codec(argv[i + 1], codec)){
+            ++i;
+        }else if(arg == "--channel" && i + 1 < argc){
+            selected.emplace_back();
+            selected.back().name = argv[++i];
+        }else if(arg == "--qos-file" && i + 1 < argc && qos_profiles.load_file(argv[i + 1], qos_error)){
+            ++i;
+        }else if(arg == "--qos" && i + 1 < argc){
+            telemetry_qos_profile = argv[++i];
+        }else if(arg == "--take-batch" && i + 1 < argc && parse_count(argv[i + 1], take_batch)){
+            take_batch = std::max<size_t>(1, take_batch);
+            ++i;
+        }else if(arg == "--latency-window" && i + 1 < argc && parse_latency_window(argv[i + 1], latency_window_ms)){
+            ++i;
+        }else{
+            if(!qos_error.empty()) std::cerr << "QoS profiles : " << qos_error << std::endl;
+            print_usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    const qosProfile* telemetry_profile = qos_profiles.find(telemetry_qos_profile);
+    if(!telemetry_profile){
+        std::cerr << "Unknown QoS profile " << telemetry_qos_profile << std::endl;
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    wakeStats wake;
 
     // Logger initalized
     init_logging();
 
+    std::thread stop_thread;
     try{
         dds::domain::DomainParticipant participant(domain::default_id());
-        dds::topic::Topic<SensorData::RawSensorData> sensorTopic(participant, "SENSOR-TELEMETRY");
+        dds::topic::Topic<SensorData::ChannelFrame> sensorTopic(participant, "SENSOR-TELEMETRY");
         dds::sub::Subscriber subscriber(participant);
-        dds::sub::qos::DataReaderQos reader_qos;
-        reader_qos << dds::core::policy::Reliability::Reliable() << dds::core::policy::History::KeepLast(10) << dds::core::policy::Durability::TransientLocal() << dds::core::policy::Deadline(dds::core::Duration::from_millisecs(1000));
+        // History is per channel (instance): late-join-snapshot hands a late joiner
+        // the last frames of every sensor
+        const auto reader_qos = make_dds_qos<dds::sub::qos::DataReaderQos>(*telemetry_profile);
 
-        dds::sub::DataReader<SensorData::RawSensorData> sensorReader(subscriber, sensorTopic);
+        dds::sub::DataReader<SensorData::ChannelFrame> sensorReader(subscriber, sensorTopic, reader_qos);
 
-        int msg_count = 0;
-        while(!ctrl_switch){
-            auto temporary_sensor_data = sensorReader.take();
+        dds::topic::Topic<SensorData::ChannelDictionary> channelTopic(participant, "SENSOR-CHANNELS");
+        const auto dictionary_qos = make_dds_qos<dds::sub::qos::DataReaderQos>(
+            *qos_profiles.find(qosProfileSet::CHANNEL_DICTIONARY));
+        dds::sub::DataReader<SensorData::ChannelDictionary> channelReader(subscriber, channelTopic, dictionary_qos);
+
+        dds::sub::cond::ReadCondition telemetry_ready(sensorReader, dds::sub::status::DataState::new_data());
+        dds::sub::cond::ReadCondition dictionary_ready(channelReader, dds::sub::status::DataState::new_data());
+        dds::core::cond::GuardCondition shutdown_guard;
+        dds::core::cond::WaitSet waitset;
+        waitset += telemetry_ready;
+        waitset += dictionary_ready;
+        waitset += shutdown_guard;
+
+        // Decode workers, one decode state and one link to the stats stage each
+        const size_t decode_workers = DECODE_WORKERS ? DECODE_WORKERS : std::max(1u, std::thread::hardware_concurrency());
+        std::vector<std::unique_ptr<decodeState>> decode_states;
+        for(size_t i = 0; i < decode_workers; ++i){
+            decode_states.push_back(std::make_unique<decodeState>(codec));
+            decoded_links.push_back(std::make_unique<decoded_link>(DECODED_LINK_CAPACITY));
+            decoded_links.back()->attach_notifier(&decoded_notifier);
+        }
+        decode_pool decoders(decode_workers, [&](size_t worker, size_t channel, std::vector<receivedFrame>& batch){
+            decode_batch(channel, batch, *decode_states[worker], *decoded_links[worker]);
+        });
+        for(size_t c = 0; c < DECODE_POOL_CHANNELS; ++c){
+            decoders.add_channel(c);
+        }
 
+        std::thread stats_thread(monitor_stats, latency_window_ms);
+        decoders.start();
+        std::thread dashboard_thread(dashboard_loop, std::cref(wake), std::cref(decoders));
+
+        // ENTER (or end of input) stops the subscriber
+        stop_thread = std::thread([&shutdown_guard]{
+            std::string line;
+            std::getline(std::cin, line);
+            ctrl_switch.store(true);
+            shutdown_guard.trigger_value(true);
+        });
+        std::cout << "Press ENTER to stop the subscriber\n";
+
+        // Receive stage: frames are copied out of the loan and queued by channel key
+        int64_t wake_us = 0;
+        auto on_samples = [&](const dds::sub::LoanedSamples<SensorData::ChannelFrame>& temporary_sensor_data){
+            stageTimer timer(receive_stage);
+            size_t received = 0;
+            uint64_t rec_time = std::chrono::duration_cast<std::chrono::milliseconds>(
+                                    std::chrono::system_clock::now().time_since_epoch()
+                                ).count();
+            {
+                std::lock_guard<std::mutex> lock(wake.latency_mutex);
+                for(const auto& it: temporary_sensor_data){
+                    if(it.info().valid()) wake.latency.record(wake_us - it.info().timestamp().to_microsecs());
+                }
+            }
             for(auto& it: temporary_sensor_data){
                 if(!it.info().valid()) continue;
+                wake.frames++;
 
-                uint64_t rec_time = std::chrono::duration_cast<std::chrono::milliseconds>(
-                                        std::chrono::system_clock::now().time_since_epoch()
-                                    ).count();
-
-                RECIVED_DATA data;
-                // Converting raw into mangable data 
-                static_cast<sensorData::msg&>(data) = on_data_recived(it.data());
-                // adding recived time stamp
-                data.revive_time = rec_time;
-                
-                // logging final data 
-                // Depriciated
-                // log_message(data);
-                on_recived_log_message(data);
-
-                                    
-                std::string sensor_id = data.sensor_id();
-                uint64_t current_seq = data.sequence_num();
-                int64_t lat = latency(data);
-                
-                latency_sensor[sensor_id].push_back(lat);
-                total_received_sensor[sensor_id]++;
-                latest_value[sensor_id] = data.value();
-                latest_seq[sensor_id] = current_seq;
-                latest_lat[sensor_id] = lat;
-
-                // Gap detection
-                if(seq_map.count(sensor_id)){
-                    int32_t expected = seq_map[sensor_id] + 1;
-                    if(current_seq != expected){
-                        int32_t gap_size = current_seq - expected;
-                        gaps_detected[sensor_id] += gap_size;
-                    }
-                    total_expected_sensor[sensor_id] += current_seq - seq_map[sensor_id];
-                } else {
-                    total_expected_sensor[sensor_id] = 1;
+                // Copied from the loan straight into the pool link slot's own buffer
+                const SensorData::ChannelFrame& sample = it.data();
+                auto fill = [&](receivedFrame& slot){
+                    slot.channel = sample.channel();
+                    slot.received_ms = rec_time;
+                    slot.bytes.assign(sample.data().begin(), sample.data().end());
+                };
+                // Back-pressure: a slow pipeline holds frames in the reader history
+                while(!decoders.submit_with(sample.channel() % DECODE_POOL_CHANNELS, fill)){
+                    std::this_thread::yield();
                 }
-                seq_map[sensor_id] = current_seq;
+                received++;
+            }
+            if(received > 0) timer.finish(received);
+        };
 
-                msg_count++;
-                
-                // Refresh dashboard every 10 messages
-                if (msg_count % 10 == 0) {
-                    printDashboard(total_received_sensor, total_expected_sensor, gaps_detected, latency_sensor, latest_value, latest_seq, latest_lat);
+        while(!ctrl_switch){
+            try{
+                waitset.wait(dds::core::Duration::from_millisecs(
+                    std::chrono::duration_cast<std::chrono::milliseconds>(WAITSET_TIMEOUT).count()));
+            }catch(const dds::core::TimeoutError&){
+                wake.timeouts++;
+                continue;
+            }
+            if(ctrl_switch) break;
+            wake.wakeups++;
+            wake_us = std::chrono::duration_cast<std::chrono::microseconds>(
+                          std::chrono::system_clock::now().time_since_epoch()
+                      ).count();
+
+            for(const auto& it: channelReader.take()){
+                if(it.info().valid()) on_channel_dictionary(it.data(), selected);
+            }
+            if(selected.empty()){
+                on_samples(sensorReader.select().max_samples(take_batch).take());
+                continue;
+            }
+            // Only the selected instances are taken; the others are never decoded and
+            // the per-instance history bounds what they keep in the reader
+            for(selectedChannel& channel: selected){
+                if(channel.instance.is_nil()){
+                    if(!channel.named) continue;
+                    channel.instance = sensorReader.lookup_instance(channel.key);
+                    if(channel.instance.is_nil()) continue;
+                }
+                // Drained here: whatever is left unread below gets marked read
+                size_t taken = take_batch;
+                while(taken == take_batch){
+                    const auto samples = sensorReader.select().instance(channel.instance).max_samples(take_batch).take();
+                    taken = samples.length();
+                    on_samples(samples);
                 }
             }
+            // Unselected frames are only marked read, so the ReadCondition does not
+            // keep waking the loop for them
+            sensorReader.select().state(dds::sub::status::DataState::new_data()).read();
         }
+        stop_thread.join();
+
+        // Stages shut down front to back, each after its input has drained
+        decoders.stop();
+        ctrl_switch_stats.store(true);
+        decoded_notifier.notify();
+        stats_thread.join();
+        ctrl_switch_dashboard.store(true);
+        dashboard_thread.join();
 
     }catch(const dds::core::Exception& e){
         std::cerr << "DDS Error: " << e.what() << std::endl;
+        // Still blocked on stdin
+        if(stop_thread.joinable()) stop_thread.detach();
         return 1;
     }
-}
\ No newline at end of file
+}
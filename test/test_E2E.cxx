@@ -9,6 +9,7 @@
 #include <mutex>
 #include <condition_variable>
 #include "utilites/safe_queue.h"
+#include "src/common/utilities/time_window.h"
 #include "sensor.pb.h"
 
 // ------------------------
@@ -28,46 +29,50 @@ void aggregator(safeQueue<TestMsg>& temp,
                 safeQueue<TestMsg>& pressure,
                 safeQueue<TestMsg>& flow,
                 std::vector<std::string>& serialized_outputs,
-                std::atomic<bool>& stop_flag) {
+                std::atomic<bool>& stop_flag,
+                queueNotifier& notifier) {
 
-    const int64_t TOLERANCE_MS = 1000;
+    const int64_t WINDOW_MS = 1000;
+    const int64_t LATENESS_MS = 200;
     sensor_proto::proto_serial_data proto_msg;
+    timeWindowEngine<TestMsg> window_engine(WINDOW_MS, LATENESS_MS);
 
     std::vector<TestMsg> temporary_container;
-    TestMsg data;
+    std::string buffer;
+
+    auto publish_window = [&](int64_t, std::vector<TestMsg>& group) {
+        for(const auto& msg : group) {
+            proto_msg.set_sensor_id(msg.sensor_id);
+            proto_msg.set_value(msg.value);
+            proto_msg.set_timestamp(msg.timestamp);
+            proto_msg.set_sequence_num(msg.sequence_num);
+
+            proto_msg.SerializeToString(&buffer);
+            serialized_outputs.push_back(buffer);
+        }
+    };
 
     while(!stop_flag) {
-        if(temp.try_pop(data)) temporary_container.push_back(data);
-        if(pressure.try_pop(data)) temporary_container.push_back(data);
-        if(flow.try_pop(data)) temporary_container.push_back(data);
-
-        while(!temporary_container.empty()) {
-            uint64_t ref_ts = temporary_container.front().timestamp;
-            std::vector<TestMsg> to_publish;
-
-            for(auto it = temporary_container.begin(); it != temporary_container.end(); ) {
-                if(std::abs(int64_t(it->timestamp - ref_ts)) <= TOLERANCE_MS) {
-                    to_publish.push_back(*it);
-                    it = temporary_container.erase(it);
-                } else {
-                    ++it;
-                }
-            }
-
-            for(auto& msg : to_publish) {
-                proto_msg.set_sensor_id(msg.sensor_id);
-                proto_msg.set_value(msg.value);
-                proto_msg.set_timestamp(msg.timestamp);
-                proto_msg.set_sequence_num(msg.sequence_num);
-
-                std::string buffer;
-                proto_msg.SerializeToString(&buffer);
-                serialized_outputs.push_back(buffer);
-            }
-
-            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        const uint64_t seen_epoch = notifier.epoch();
+        size_t received = 0;
+        received += temp.drain_into(temporary_container);
+        received += pressure.drain_into(temporary_container);
+        received += flow.drain_into(temporary_container);
+
+        if(received == 0) {
+            notifier.wait_for(seen_epoch, std::chrono::milliseconds(50));
+            continue;
         }
+
+        for(auto& msg : temporary_container) {
+            const int64_t ts = int64_t(msg.timestamp);
+            window_engine.insert(std::move(msg), ts);
+        }
+        temporary_container.clear();
+        window_engine.flush_ready(publish_window);
     }
+
+    window_engine.flush_all(publish_window);
 }
 
 // ------------------------
@@ -77,6 +82,10 @@ TEST(E2E, PipelineSerializationTest) {
     safeQueue<TestMsg> temp_queue, pres_queue, flow_queue;
     std::vector<std::string> serialized_outputs;
     std::atomic<bool> stop_flag{false};
+    queueNotifier notifier;
+    temp_queue.attach_notifier(&notifier);
+    pres_queue.attach_notifier(&notifier);
+    flow_queue.attach_notifier(&notifier);
 
     // Producer threads
     auto producer = [](safeQueue<TestMsg>& q, const std::string& id){
@@ -93,7 +102,7 @@ TEST(E2E, PipelineSerializationTest) {
 
     // Aggregator thread
     std::thread agg_th(aggregator, std::ref(temp_queue), std::ref(pres_queue), std::ref(flow_queue),
-                       std::ref(serialized_outputs), std::ref(stop_flag));
+                       std::ref(serialized_outputs), std::ref(stop_flag), std::ref(notifier));
 
     temp_th.join();
     pres_th.join();
@@ -102,6 +111,7 @@ TEST(E2E, PipelineSerializationTest) {
     // Give aggregator a moment to process
     std::this_thread::sleep_for(std::chrono::milliseconds(100));
     stop_flag = true;
+    notifier.notify();
     agg_th.join();
 
     // ------------------------
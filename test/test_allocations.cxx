@@ -0,0 +1,195 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+#include "src/common/utilities/spsc_ring_buffer.h"
+#include "sensor.pb.h"
+#include "src/Serializer/frame_decoder.h"
+
+// ------------------------
+// Counting allocator hooks
+// ------------------------
+#if defined(__GNUC__) && !defined(__clang__)
+// GCC flags the malloc/free pair behind replaced new/delete once they get inlined
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+static std::atomic<bool> g_counting{false};
+static std::atomic<uint64_t> g_allocations{0};
+
+void* operator new(std::size_t size){
+    if (g_counting.load(std::memory_order_relaxed)) g_allocations++;
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+void* operator new[](std::size_t size){
+    return operator new(size);
+}
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    if (g_counting.load(std::memory_order_relaxed)) g_allocations++;
+    return std::malloc(size ? size : 1);
+}
+void* operator new[](std::size_t size, const std::nothrow_t& tag) noexcept {
+    return operator new(size, tag);
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { operator delete(p); }
+void operator delete(void* p, std::size_t) noexcept { operator delete(p); }
+void operator delete[](void* p, std::size_t) noexcept { operator delete(p); }
+
+// ------------------------
+// Minimal sensor message
+// ------------------------
+struct TestMsg {
+    std::string sensor_id;
+    double value;
+    uint64_t timestamp;
+    uint32_t sequence_num;
+};
+
+// Mirrors the publisher hot path: sensor push -> link -> aggregator drain ->
+// frame building -> frame serialized straight into the DDS sample buffer
+struct publishPath {
+    static constexpr int FRAME_READINGS = 16;
+
+    spscRingBuffer<TestMsg> link{64};
+    std::vector<TestMsg> batch;
+    sensor_proto::proto_frame frame;
+    std::vector<uint8_t> dds_bytes;
+    uint32_t seq = 0;
+
+    publishPath(){
+        batch.reserve(64);
+        // Room for a full frame even once the varints have widened
+        dds_bytes.reserve(FRAME_READINGS * 32);
+        frame.add_sensors("Temp-Sensor");
+    }
+
+    void write_frame(){
+        const size_t size = frame.ByteSizeLong();
+        dds_bytes.resize(size);
+        frame.SerializeWithCachedSizesToArray(dds_bytes.data());
+        frame.clear_sensor_index();
+        frame.clear_value();
+        frame.clear_timestamp();
+        frame.clear_sequence_num();
+    }
+
+    size_t publish_one(){
+        TestMsg msg{"Temp-Sensor", 21.5 + seq, 1000 + uint64_t(seq) * 100, seq};
+        seq++;
+        link.push_in_queue(std::move(msg));
+
+        batch.clear();
+        link.drain_into(batch);
+        for (const auto& m : batch) {
+            frame.add_sensor_index(0);
+            frame.add_value(m.value);
+            frame.add_timestamp(m.timestamp);
+            frame.add_sequence_num(m.sequence_num);
+            if (frame.value_size() == FRAME_READINGS) write_frame();
+        }
+        return batch.size();
+    }
+};
+
+TEST(Allocations, SteadyStatePublishIsAllocationFree) {
+    publishPath path;
+
+    // Warm-up lets every reused buffer reach its working capacity
+    for (int i = 0; i < 100; ++i) path.publish_one();
+
+    const int iterations = 1000;
+    size_t published = 0;
+    g_allocations = 0;
+    g_counting = true;
+    for (int i = 0; i < iterations; ++i) published += path.publish_one();
+    g_counting = false;
+
+    EXPECT_EQ(published, size_t(iterations));
+    EXPECT_EQ(g_allocations.load(), 0u) << "allocations per message: "
+                                        << double(g_allocations.load()) / iterations;
+
+    sensor_proto::proto_frame decoded;
+    ASSERT_TRUE(decoded.ParseFromArray(path.dds_bytes.data(), int(path.dds_bytes.size())));
+    ASSERT_EQ(decoded.sequence_num_size(), publishPath::FRAME_READINGS);
+    const uint32_t last_written = path.seq / publishPath::FRAME_READINGS * publishPath::FRAME_READINGS - 1;
+    EXPECT_EQ(decoded.sequence_num(publishPath::FRAME_READINGS - 1), last_written);
+}
+
+// Mirrors the subscriber receive path: payload copied from the DDS loan into the
+// decode pool link slot, swapped out into the worker's batch
+struct poolFrame {
+    uint32_t channel = 0;
+    std::vector<uint8_t> bytes;
+};
+
+TEST(Allocations, SteadyStatePoolHandoffIsAllocationFree) {
+    spscRingBuffer<poolFrame> link(8);
+    std::vector<poolFrame> batch;
+    batch.reserve(8);
+    const std::vector<uint8_t> loan(512, 0x5a);
+
+    size_t handed = 0;
+    auto receive = [&](int frames){
+        for (int i = 0; i < frames; ++i) {
+            link.push_with([&](poolFrame& slot){
+                slot.channel = uint32_t(i);
+                slot.bytes.assign(loan.begin(), loan.end());
+            });
+        }
+        batch.resize(size_t(frames));
+        handed += link.swap_into(batch);
+    };
+    // Warm-up gives every slot and batch element a buffer of working size
+    for (int i = 0; i < 20; ++i) receive(4);
+
+    g_allocations = 0;
+    g_counting = true;
+    for (int i = 0; i < 1000; ++i) receive(4);
+    g_counting = false;
+
+    EXPECT_EQ(handed, 4u * 1020);
+    EXPECT_EQ(g_allocations.load(), 0u);
+    EXPECT_EQ(batch[3].channel, 3u);
+    EXPECT_EQ(batch[3].bytes, loan);
+}
+
+TEST(Allocations, SteadyStateFrameDecodeIsAllocationFree) {
+    sensor_proto::proto_frame frame;
+    frame.add_sensors("Temp-Sensor");
+    frame.add_sensors("Press-Sensor");
+    for (int i = 0; i < 64; ++i) {
+        frame.add_sensor_index(i % 2);
+        frame.add_value(20.0 + i);
+        frame.add_timestamp(1736503200000 + i);
+        frame.add_sequence_num(i / 2);
+    }
+    std::vector<uint8_t> bytes(frame.ByteSizeLong());
+    frame.SerializeWithCachedSizesToArray(bytes.data());
+
+    frameDecoder decoder;
+    std::vector<sensorRecord> records;
+    // Warm-up interns the names and sizes every reused buffer
+    ASSERT_TRUE(decoder.decode(bytes.data(), bytes.size(), records));
+
+    g_allocations = 0;
+    g_counting = true;
+    size_t decoded = 0;
+    for (int i = 0; i < 1000; ++i) {
+        decoder.decode(bytes.data(), bytes.size(), records);
+        decoded += records.size();
+    }
+    g_counting = false;
+
+    EXPECT_EQ(decoded, 64000u);
+    EXPECT_EQ(g_allocations.load(), 0u);
+    EXPECT_EQ(decoder.sensor_count(), 2u);
+    EXPECT_EQ(decoder.name(records[51].sensor), "Press-Sensor");
+    EXPECT_EQ(records[51].sequence_num, 25);
+
+    // Truncated input is rejected rather than half-decoded
+    EXPECT_FALSE(decoder.decode(bytes.data(), bytes.size() - 3, records));
+    EXPECT_TRUE(records.empty());
+}
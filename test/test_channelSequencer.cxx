@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "src/common/utilities/channel_sequencer.h"
+#include "src/common/utilities/sharded_aggregator.h"
+
+struct TestMsg {
+    uint32_t channel;
+    uint32_t sequence_num;
+};
+
+// One worker output: a pool batch of one channel, stamped by the sequencer
+struct TestFrame {
+    size_t channel = 0;
+    uint64_t stamp = 0;
+    std::vector<uint32_t> sequence_nums;
+};
+
+TEST(ChannelSequencer, KeepsChannelOrderAcrossSteals) {
+    const size_t workers = 4;
+    const size_t channels = 8;
+    const uint32_t per_channel = 2000;
+
+    channelSequencer sequencer(channels);
+    std::vector<std::unique_ptr<spscRingBuffer<TestFrame>>> links;
+    for (size_t w = 0; w < workers; ++w) links.push_back(std::make_unique<spscRingBuffer<TestFrame>>(1024));
+
+    shardedAggregator<TestMsg> pool(workers, [&](size_t worker, size_t channel, std::vector<TestMsg>& batch){
+        // Uneven service times make channels change workers mid-stream
+        if (batch.front().sequence_num % 7 == 0) std::this_thread::sleep_for(std::chrono::microseconds(200));
+        auto fill = [&](TestFrame& slot){
+            slot.channel = channel;
+            slot.stamp = sequencer.next(channel);
+            slot.sequence_nums.clear();
+            for (const auto& msg : batch) slot.sequence_nums.push_back(msg.sequence_num);
+        };
+        while (!links[worker]->push_with(fill)) std::this_thread::yield();
+    }, 64, 4);
+
+    // Every key maps to worker 0, so the other workers only get work by stealing
+    for (size_t c = 0; c < channels; ++c) pool.add_channel(c * workers);
+    pool.start();
+
+    std::vector<uint32_t> next_seq(channels, 0);
+    uint64_t seen = 0, out_of_order = 0;
+    std::thread consumer([&]{
+        auto order_of = [](const TestFrame& frame){ return std::pair<size_t, uint64_t>{frame.channel, frame.stamp}; };
+        auto check = [&](TestFrame& frame){
+            for (uint32_t seq : frame.sequence_nums) {
+                if (seq != next_seq[frame.channel]) out_of_order++;
+                next_seq[frame.channel] = seq + 1;
+                seen++;
+            }
+        };
+        bool waiting = false;
+        const uint64_t total = uint64_t(channels) * per_channel;
+        while (seen < total) {
+            if (sequencer.drain(links, 16, order_of, check, waiting) == 0) std::this_thread::yield();
+        }
+    });
+
+    for (uint32_t seq = 0; seq < per_channel; ++seq) {
+        for (size_t c = 0; c < channels; ++c) {
+            TestMsg msg{uint32_t(c), seq};
+            while (!pool.submit(c, std::move(msg))) std::this_thread::yield();
+        }
+    }
+    consumer.join();
+    pool.stop();
+
+    EXPECT_EQ(seen, uint64_t(channels) * per_channel);
+    EXPECT_EQ(out_of_order, 0u);
+    uint64_t stolen = 0;
+    for (size_t w = 0; w < pool.worker_count(); ++w) stolen += pool.stats(w).stolen;
+    EXPECT_GT(stolen, 0u);
+    for (const auto& link : links) EXPECT_TRUE(link->empty());
+}
@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "src/Serializer/frame_codec.h"
+#include "src/Serializer/frame_decoder.h"
+
+struct codecCase {
+    frameCodec codec;
+    bool compress;
+};
+
+static std::vector<uint8_t> encode_readings(frameEncoder& encoder, int readings){
+    for (int i = 0; i < readings; ++i) {
+        encoder.add(static_cast<uint32_t>(i % 3), 20.0 + i * 0.25, 1736503200000 + i * 10, 1000 + i / 3);
+    }
+    std::vector<uint8_t> bytes;
+    encoder.finish(bytes);
+    return bytes;
+}
+
+TEST(FrameCodec, EveryCodecRoundTrips) {
+    for (const codecCase c : {codecCase{frameCodec::Protobuf, false}, codecCase{frameCodec::Protobuf, true},
+                              codecCase{frameCodec::Cdr, false}, codecCase{frameCodec::Fixed, false},
+                              codecCase{frameCodec::Schema, false}}) {
+        SCOPED_TRACE(std::string(frame_codec_name(c.codec)) + (c.compress ? " compressed" : ""));
+        frameEncoder encoder(c.codec, c.compress);
+        frameDecoder decoder(c.codec);
+        std::vector<sensorRecord> records;
+
+        // Twice, so the second frame runs on reused encoder state
+        for (int round = 0; round < 2; ++round) {
+            const std::vector<uint8_t> bytes = encode_readings(encoder, 30);
+            EXPECT_TRUE(encoder.empty());
+            ASSERT_TRUE(decoder.decode(bytes.data(), bytes.size(), records));
+            ASSERT_EQ(records.size(), 30u);
+
+            // Compressed frames are grouped per channel, so check readings by content
+            int matched = 0;
+            for (const sensorRecord& r : records) {
+                const int i = static_cast<int>((r.timestamp - 1736503200000) / 10);
+                ASSERT_GE(i, 0);
+                ASSERT_LT(i, 30);
+                EXPECT_EQ(decoder.name(r.sensor), "channel-" + std::to_string(i % 3));
+                EXPECT_EQ(r.value, 20.0 + i * 0.25);
+                EXPECT_EQ(r.sequence_num, 1000 + i / 3);
+                matched++;
+            }
+            EXPECT_EQ(matched, 30);
+        }
+
+        // An empty frame is still a valid frame
+        std::vector<uint8_t> empty;
+        encoder.finish(empty);
+        EXPECT_TRUE(decoder.decode(empty.data(), empty.size(), records));
+        EXPECT_TRUE(records.empty());
+    }
+}
+
+TEST(FrameCodec, CdrLayoutMatchesTheIdlType) {
+    frameEncoder encoder(frameCodec::Cdr);
+    encoder.add(7, 1.5, 100, 3);
+    encoder.add(9, -2.0, 200, 4);
+    std::vector<uint8_t> bytes;
+    encoder.finish(bytes);
+
+    // Encapsulation + length + two readings, the second padded after its channel
+    ASSERT_EQ(bytes.size(), 4u + 64u);
+    EXPECT_EQ(bytes[1], 0x01);   // CDR_LE
+    const uint8_t* body = bytes.data() + 4;
+    EXPECT_EQ(le_load32(body), 2u);
+    EXPECT_EQ(le_load32(body + 4), 7u);
+    EXPECT_EQ(bit_cast_value<double>(le_load64(body + 8)), 1.5);
+    EXPECT_EQ(le_load64(body + 16), 100u);
+    EXPECT_EQ(le_load64(body + 24), 3u);
+    EXPECT_EQ(le_load32(body + 32), 9u);
+    EXPECT_EQ(le_load32(body + 36), 0u);
+    EXPECT_EQ(bit_cast_value<double>(le_load64(body + 40)), -2.0);
+}
+
+TEST(FrameCodec, TruncatedFramesAreRejected) {
+    for (frameCodec codec : {frameCodec::Cdr, frameCodec::Fixed, frameCodec::Schema}) {
+        SCOPED_TRACE(frame_codec_name(codec));
+        frameEncoder encoder(codec);
+        std::vector<uint8_t> bytes = encode_readings(encoder, 5);
+        frameDecoder decoder(codec);
+        std::vector<sensorRecord> records;
+        EXPECT_FALSE(decoder.decode(bytes.data(), bytes.size() - 1, records));
+        EXPECT_TRUE(records.empty());
+        bytes.push_back(0);
+        EXPECT_FALSE(decoder.decode(bytes.data(), bytes.size(), records));
+    }
+}
@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstring>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+#include "src/common/utilities/gorilla_codec.h"
+#include "src/Serializer/frame_decoder.h"
+
+struct reading {
+    int64_t ts;
+    double value;
+    int64_t seq;
+};
+
+static std::vector<reading> round_trip(const std::vector<reading>& in, size_t& encoded_bytes){
+    gorillaSeriesEncoder enc;
+    for (const auto& r : in) enc.append(r.ts, r.value, r.seq);
+    encoded_bytes = enc.bytes().size();
+
+    std::vector<reading> out;
+    gorillaSeriesDecoder dec(enc.bytes().data(), enc.bytes().size(), enc.count());
+    reading r;
+    while (dec.next(r.ts, r.value, r.seq)) out.push_back(r);
+    return out;
+}
+
+TEST(GorillaCodec, RegularSeriesCompressesTenfold) {
+    // 100 ms period with a little scheduling jitter, values on a 0.1 grid that
+    // mostly repeat, sequence numbers stepping by one
+    std::mt19937 rng(3);
+    std::vector<reading> in;
+    int64_t ts = 1736503200000;
+    double value = 21.5;
+    for (int i = 0; i < 256; ++i) {
+        ts += 100 + (i % 16 == 0 ? 1 : 0);
+        if (rng() % 8 == 0) value += (rng() % 2 ? 0.5 : -0.5);
+        in.push_back({ts, value, 1000 + i});
+    }
+
+    size_t bytes = 0;
+    const auto out = round_trip(in, bytes);
+    ASSERT_EQ(out.size(), in.size());
+    for (size_t i = 0; i < in.size(); ++i) {
+        EXPECT_EQ(out[i].ts, in[i].ts);
+        EXPECT_EQ(out[i].value, in[i].value);
+        EXPECT_EQ(out[i].seq, in[i].seq);
+    }
+    // Raw columns are 24 bytes per reading
+    EXPECT_LT(bytes * 10, in.size() * 24) << bytes << " bytes";
+}
+
+TEST(GorillaCodec, IrregularSeriesRoundTripsExactly) {
+    std::mt19937_64 rng(11);
+    std::vector<reading> in = {
+        {0, 0.0, 0},
+        {std::numeric_limits<int64_t>::max() / 2, -0.0, -5},
+        {-1000, std::numeric_limits<double>::infinity(), 7},
+        {5, std::numeric_limits<double>::denorm_min(), 7},
+        {6, std::nan(""), std::numeric_limits<int64_t>::min() / 2},
+    };
+    for (int i = 0; i < 500; ++i) {
+        const uint64_t bits = rng();
+        double v;
+        std::memcpy(&v, &bits, sizeof v);
+        in.push_back({static_cast<int64_t>(rng() % 100000) - 50000, v, static_cast<int64_t>(rng() % 1000)});
+    }
+
+    size_t bytes = 0;
+    const auto out = round_trip(in, bytes);
+    ASSERT_EQ(out.size(), in.size());
+    for (size_t i = 0; i < in.size(); ++i) {
+        EXPECT_EQ(out[i].ts, in[i].ts) << i;
+        EXPECT_EQ(gorilla_detail::double_bits(out[i].value), gorilla_detail::double_bits(in[i].value)) << i;
+        EXPECT_EQ(out[i].seq, in[i].seq) << i;
+    }
+}
+
+TEST(GorillaCodec, BlockCarriesSeveralSeries) {
+    gorillaBlockEncoder enc;
+    for (int round = 0; round < 2; ++round) {   // the encoder is reused across blocks
+        std::string block;
+        for (int i = 0; i < 30; ++i) enc.append(static_cast<uint32_t>(i % 3), 1000 + i * 100, 20.0 + i % 3, i / 3);
+        enc.finish(block);
+        EXPECT_TRUE(enc.empty());
+
+        std::vector<int> per_series(3, 0);
+        std::vector<int64_t> last_seq(3, -1);
+        bool ordered = true;
+        const bool ok = gorilla_decode_block(reinterpret_cast<const uint8_t*>(block.data()), block.size(),
+            [&](uint32_t id, int64_t, double value, int64_t seq){
+                per_series[id]++;
+                ordered = ordered && seq == last_seq[id] + 1 && value == 20.0 + id;
+                last_seq[id] = seq;
+            });
+        EXPECT_TRUE(ok);
+        EXPECT_TRUE(ordered);
+        EXPECT_EQ(per_series, (std::vector<int>{10, 10, 10}));
+
+        EXPECT_FALSE(gorilla_decode_block(reinterpret_cast<const uint8_t*>(block.data()), block.size() - 1,
+                                          [](uint32_t, int64_t, double, int64_t){}));
+    }
+}
+
+TEST(GorillaCodec, CompressedFrameDecodesLikeColumns) {
+    sensor_proto::proto_frame columns, compressed;
+    gorillaBlockEncoder enc;
+    for (auto* frame : {&columns, &compressed}) {
+        frame->add_sensors("Temp-Sensor");
+        frame->add_sensors("Press-Sensor");
+    }
+    for (int i = 0; i < 200; ++i) {
+        const uint32_t sensor = i % 2;
+        const int64_t ts = 1736503200000 + (i / 2) * 100;
+        const double value = sensor ? 101.3 : 21.5 + (i / 20) * 0.5;
+        columns.add_sensor_index(sensor);
+        columns.add_value(value);
+        columns.add_timestamp(ts);
+        columns.add_sequence_num(i / 2);
+        enc.append(sensor, ts, value, i / 2);
+    }
+    enc.finish(*compressed.mutable_compressed());
+
+    const std::string column_bytes = columns.SerializeAsString();
+    const std::string compressed_bytes = compressed.SerializeAsString();
+    EXPECT_LT(compressed_bytes.size() * 4, column_bytes.size());
+
+    frameDecoder decoder;
+    std::vector<sensorRecord> a, b;
+    ASSERT_TRUE(decoder.decode(reinterpret_cast<const uint8_t*>(column_bytes.data()), column_bytes.size(), a));
+    ASSERT_TRUE(decoder.decode(reinterpret_cast<const uint8_t*>(compressed_bytes.data()), compressed_bytes.size(), b));
+    ASSERT_EQ(a.size(), b.size());
+
+    // The block groups readings by sensor, so compare per sensor in order
+    for (uint32_t sensor = 0; sensor < 2; ++sensor) {
+        std::vector<sensorRecord> sa, sb;
+        for (const auto& r : a) if (r.sensor == sensor) sa.push_back(r);
+        for (const auto& r : b) if (r.sensor == sensor) sb.push_back(r);
+        ASSERT_EQ(sa.size(), sb.size());
+        for (size_t i = 0; i < sa.size(); ++i) {
+            EXPECT_EQ(sa[i].value, sb[i].value);
+            EXPECT_EQ(sa[i].timestamp, sb[i].timestamp);
+            EXPECT_EQ(sa[i].sequence_num, sb[i].sequence_num);
+        }
+    }
+
+    // A series tagged with a sensor index the frame does not list is rejected
+    compressed.mutable_sensors()->RemoveLast();
+    const std::string bad = compressed.SerializeAsString();
+    EXPECT_FALSE(decoder.decode(reinterpret_cast<const uint8_t*>(bad.data()), bad.size(), b));
+    EXPECT_TRUE(b.empty());
+}
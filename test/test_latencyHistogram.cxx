@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include "src/common/utilities/latency_histogram.h"
+
+static int64_t exact_percentile(std::vector<int64_t> values, double q){
+    std::sort(values.begin(), values.end());
+    const size_t rank = std::max<size_t>(1, static_cast<size_t>(std::ceil(q * values.size())));
+    return values[rank - 1];
+}
+
+TEST(LatencyHistogram, PercentilesWithinBucketResolution) {
+    latencyHistogram hist;
+    EXPECT_EQ(hist.summary().count, 0u);
+
+    // Below SUB_BUCKETS every value has its own bucket
+    for (int64_t v = 1; v <= 10; ++v) hist.record(v);
+    latencySummary small = hist.summary();
+    EXPECT_EQ(small.p50, 5);
+    EXPECT_EQ(small.p90, 9);
+    EXPECT_EQ(small.max, 10);
+    EXPECT_DOUBLE_EQ(small.mean, 5.5);
+
+    // Long-tailed values: reported percentiles sit at most one bucket (1/32) above the true ones
+    hist.reset();
+    std::mt19937_64 rng(7);
+    std::lognormal_distribution<double> dist(6.0, 1.5);
+    std::vector<int64_t> values;
+    for (int i = 0; i < 100000; ++i) {
+        values.push_back(static_cast<int64_t>(dist(rng)));
+        hist.record(values.back());
+    }
+    const latencySummary s = hist.summary();
+    EXPECT_EQ(s.count, values.size());
+    EXPECT_EQ(s.max, *std::max_element(values.begin(), values.end()));
+    const double tolerance = 1.0 / latencyHistogram::SUB_BUCKETS;
+    for (auto [q, reported] : {std::pair<double, int64_t>{0.50, s.p50}, {0.90, s.p90}, {0.99, s.p99}, {0.999, s.p999}}) {
+        const int64_t exact = exact_percentile(values, q);
+        EXPECT_GE(reported, exact) << q;
+        EXPECT_LE(reported, exact + static_cast<int64_t>(exact * tolerance) + 1) << q;
+    }
+
+    // Out of range and negative values are clamped, max stays exact
+    hist.record(int64_t(1) << 40);
+    hist.record(-5);
+    EXPECT_EQ(hist.summary().max, int64_t(1) << 40);
+    EXPECT_EQ(latencyHistogram::bucket_of(-5), 0u);
+    EXPECT_EQ(latencyHistogram::bucket_of(int64_t(1) << 40), latencyHistogram::BUCKETS - 1);
+}
+
+TEST(LatencyHistogram, MergeMatchesRecordingIntoOne) {
+    latencyHistogram a, b, both;
+    for (int64_t v = 0; v < 5000; v += 3) {
+        a.record(v);
+        both.record(v);
+    }
+    for (int64_t v = 100; v < 900000; v += 977) {
+        b.record(v);
+        both.record(v);
+    }
+    a.merge(b);
+    const latencySummary merged = a.summary();
+    const latencySummary direct = both.summary();
+    EXPECT_EQ(merged.count, direct.count);
+    EXPECT_EQ(merged.p50, direct.p50);
+    EXPECT_EQ(merged.p99, direct.p99);
+    EXPECT_EQ(merged.p999, direct.p999);
+    EXPECT_EQ(merged.max, direct.max);
+    EXPECT_DOUBLE_EQ(merged.mean, direct.mean);
+}
+
+TEST(LatencyHistogram, SlidingWindowForgetsOldSlices) {
+    windowedLatencyHistogram window(1000);
+    EXPECT_EQ(window.window_ms(), 1000);
+
+    window.record(500, 10'000);     // slow burst
+    window.record(5, 10'550);
+    window.record(7, 10'950);
+
+    latencyHistogram view;
+    window.merge_into(view, 10'950);
+    EXPECT_EQ(view.count(), 3u);
+    EXPECT_EQ(view.summary().max, 500);
+
+    // 1 s later the burst has left the window
+    view.reset();
+    window.merge_into(view, 11'050);
+    EXPECT_EQ(view.count(), 2u);
+    EXPECT_EQ(view.summary().max, 7);
+
+    // A slice is reused once time comes round to it
+    window.record(9, 12'000);
+    view.reset();
+    window.merge_into(view, 12'000);
+    EXPECT_EQ(view.count(), 1u);
+    EXPECT_EQ(view.summary().max, 9);
+}
@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+#include "src/common/utilities/fast_random.h"
+#include "src/common/utilities/load_generator.h"
+
+TEST(FastRandom, SplitMixMatchesReferenceSequence) {
+    uint64_t state = 1234567;
+    EXPECT_EQ(splitmix64(state), 6457827717110365317ULL);
+    EXPECT_EQ(splitmix64(state), 3203168211198807973ULL);
+    EXPECT_EQ(splitmix64(state), 9817491932198370423ULL);
+}
+
+TEST(FastRandom, XoshiroIsDeterministicAndWorksWithStdDistributions) {
+    xoshiro256 a(42), b(42), c(43);
+    for (int i = 0; i < 100; ++i) EXPECT_EQ(a(), b());
+    EXPECT_NE(a(), c());
+
+    std::uniform_int_distribution<int> die(1, 6);
+    std::vector<int> faces(7, 0);
+    for (int i = 0; i < 60000; ++i) faces[die(a)]++;
+    for (int f = 1; f <= 6; ++f) EXPECT_NEAR(faces[f], 10000, 500);
+}
+
+TEST(FastRandom, BatchFillStaysInUnitIntervalWithFlatMean) {
+    xoshiroBatch rng(7);
+    std::vector<double> values(100003);   // not a multiple of the lane count
+    rng.fill_unit(values.data(), values.size());
+    EXPECT_GE(*std::min_element(values.begin(), values.end()), 0.0);
+    EXPECT_LT(*std::max_element(values.begin(), values.end()), 1.0);
+    const double mean = std::accumulate(values.begin(), values.end(), 0.0) / values.size();
+    EXPECT_NEAR(mean, 0.5, 0.01);
+}
+
+TEST(LoadGenerator, DistributionsHaveRequestedShape) {
+    std::vector<double> values(100000);
+
+    loadGenerator uniform({valueShape::Uniform, 20.0, 100.0});
+    uniform.generate(values);
+    EXPECT_GE(*std::min_element(values.begin(), values.end()), 20.0);
+    EXPECT_LT(*std::max_element(values.begin(), values.end()), 100.0);
+
+    loadGenerator normal({valueShape::Normal, 300.0, 5.0});
+    normal.generate(values);
+    const double mean = std::accumulate(values.begin(), values.end(), 0.0) / values.size();
+    double var = 0.0;
+    for (double v : values) var += (v - mean) * (v - mean);
+    EXPECT_NEAR(mean, 300.0, 0.2);
+    EXPECT_NEAR(std::sqrt(var / values.size()), 5.0, 0.2);
+
+    loadGenerator walk({valueShape::RandomWalk, 50.0, 0.5});
+    walk.generate(values);
+    for (size_t i = 1; i < values.size(); ++i) EXPECT_LE(std::fabs(values[i] - values[i - 1]), 0.5);
+
+    loadGenerator sine({valueShape::Sine, 10.0, 2.0, 100.0, 0.0});
+    sine.generate(values.data(), 100);
+    EXPECT_NEAR(values[0], 10.0, 1e-9);
+    EXPECT_NEAR(values[25], 12.0, 1e-9);
+    EXPECT_NEAR(values[75], 8.0, 1e-9);
+}
+
+TEST(LoadGenerator, ParsesValueDistributionOption) {
+    valueDistribution dist;
+    ASSERT_TRUE(parse_value_distribution("normal:-20.5:3", dist));
+    EXPECT_EQ(dist.shape, valueShape::Normal);
+    EXPECT_DOUBLE_EQ(dist.a, -20.5);
+    EXPECT_DOUBLE_EQ(dist.b, 3.0);
+
+    ASSERT_TRUE(parse_value_distribution("uniform:0:100", dist));
+    EXPECT_EQ(dist.shape, valueShape::Uniform);
+    EXPECT_DOUBLE_EQ(dist.b, 100.0);
+
+    ASSERT_TRUE(parse_value_distribution("sine:10:2:100:0.5", dist));
+    EXPECT_EQ(dist.shape, valueShape::Sine);
+    EXPECT_DOUBLE_EQ(dist.c, 100.0);
+    EXPECT_DOUBLE_EQ(dist.d, 0.5);
+
+    // Rejected input leaves the previous value alone
+    for (const char* bad : {"", "normal", "normal:1", "normal:1:2:3", "normal:1:-2", "normal:x:2",
+                            "normal:1:2x", "uniform:5:1", "walk:0:nan", "sine:1:2:3", "gauss:1:2"}) {
+        EXPECT_FALSE(parse_value_distribution(bad, dist)) << bad;
+    }
+    EXPECT_EQ(dist.shape, valueShape::Sine);
+}
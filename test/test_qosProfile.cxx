@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+#include <string>
+#include "src/common/utilities/qos_profile.h"
+
+TEST(QosProfile, BuiltInProfiles) {
+    qosProfileSet profiles;
+
+    const qosProfile* best_effort = profiles.find(qosProfileSet::TELEMETRY_BEST_EFFORT);
+    ASSERT_NE(best_effort, nullptr);
+    EXPECT_FALSE(best_effort->reliable);
+    EXPECT_FALSE(best_effort->transient_local);
+    EXPECT_EQ(best_effort->history_depth, 1);
+
+    const qosProfile* reliable = profiles.find(qosProfileSet::TELEMETRY_RELIABLE);
+    ASSERT_NE(reliable, nullptr);
+    EXPECT_TRUE(reliable->reliable);
+    EXPECT_FALSE(reliable->transient_local);
+
+    const qosProfile* snapshot = profiles.find(qosProfileSet::LATE_JOIN_SNAPSHOT);
+    ASSERT_NE(snapshot, nullptr);
+    EXPECT_TRUE(snapshot->reliable);
+    EXPECT_TRUE(snapshot->transient_local);
+    EXPECT_EQ(snapshot->history_depth, 10);
+    EXPECT_EQ(snapshot->deadline_ms, 1000);
+
+    EXPECT_NE(profiles.find(qosProfileSet::CHANNEL_DICTIONARY), nullptr);
+    EXPECT_EQ(profiles.find("no-such-profile"), nullptr);
+}
+
+TEST(QosProfile, FileOverridesAndAddsProfiles) {
+    qosProfileSet profiles;
+    std::string error;
+    const std::string text =
+        "# tuned for the plant network\n"
+        "[telemetry-reliable]\n"
+        "history = 50   ; deeper queue\n"
+        "\n"
+        "[ edge-uplink ]\r\n"
+        "reliability = best-effort\n"
+        "durability = transient-local\n"
+        "history = keep-all\n"
+        "latency_budget_ms = 5\n";
+    ASSERT_TRUE(profiles.parse(text, error)) << error;
+
+    // Untouched keys keep the built-in values
+    const qosProfile* reliable = profiles.find(qosProfileSet::TELEMETRY_RELIABLE);
+    ASSERT_NE(reliable, nullptr);
+    EXPECT_EQ(reliable->history_depth, 50);
+    EXPECT_TRUE(reliable->reliable);
+    EXPECT_EQ(reliable->deadline_ms, 1000);
+
+    const qosProfile* edge = profiles.find("edge-uplink");
+    ASSERT_NE(edge, nullptr);
+    EXPECT_FALSE(edge->reliable);
+    EXPECT_TRUE(edge->transient_local);
+    EXPECT_EQ(edge->history_depth, 0);
+    EXPECT_EQ(edge->latency_budget_ms, 5);
+    EXPECT_EQ(edge->deadline_ms, 0);
+}
+
+TEST(QosProfile, RejectsBadLines) {
+    std::string error;
+    EXPECT_FALSE(qosProfileSet().parse("history = 5\n", error));
+    EXPECT_NE(error.find("line 1"), std::string::npos);
+
+    EXPECT_FALSE(qosProfileSet().parse("[a]\nreliability = sometimes\n", error));
+    EXPECT_NE(error.find("line 2"), std::string::npos);
+    EXPECT_NE(error.find("reliability"), std::string::npos);
+
+    EXPECT_FALSE(qosProfileSet().parse("[a]\nhistory = 0\n", error));
+    EXPECT_FALSE(qosProfileSet().parse("[a]\ndeadline_ms = -1\n", error));
+    EXPECT_FALSE(qosProfileSet().parse("[a]\ncolour = blue\n", error));
+    EXPECT_FALSE(qosProfileSet().parse("[a\n", error));
+    EXPECT_FALSE(qosProfileSet().parse("[]\n", error));
+    EXPECT_FALSE(qosProfileSet().load_file("/nonexistent/qos.ini", error));
+}
@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "src/common/utilities/mapped_file.h"
+#include "src/common/utilities/replay_reader.h"
+
+TEST(ReplayReader, ParsesPublisherAndSubscriberLogLines) {
+    const std::string text =
+        "[2025-01-10 10:00:00.100] [t:11] [sesnor-hub] [info] Interactive control: (T/P/F)\n"
+        "[2025-01-10 10:00:00.200] [t:12] [sesnor-hub] [info] PUB sensor=Temp-Sensor value=42.5 ts=1736503200200 seq=7\n"
+        "[2025-01-10 10:00:00.300] [t:13] [sesnor-hub] [info] PUB sensor=flow-Sensor value=812.25 ts=1736503200300 rs=1736503200305 seq=8\r\n"
+        "[2025-01-10 10:00:00.400] [t:12] [sesnor-hub] [info] PUB sensor=Temp-Sensor value=oops ts=1 seq=9\n";
+
+    replayReader reader(text);
+    replayRecord rec;
+    ASSERT_TRUE(reader.next(rec));
+    EXPECT_EQ(rec.sensor_id, "Temp-Sensor");
+    EXPECT_DOUBLE_EQ(rec.value, 42.5);
+    EXPECT_EQ(rec.timestamp, 1736503200200);
+    EXPECT_EQ(rec.sequence_num, 7u);
+    // No copy: the id is a view into the original text
+    EXPECT_GE(rec.sensor_id.data(), text.data());
+    EXPECT_LT(rec.sensor_id.data(), text.data() + text.size());
+
+    ASSERT_TRUE(reader.next(rec));
+    EXPECT_EQ(rec.sensor_id, "flow-Sensor");
+    EXPECT_DOUBLE_EQ(rec.value, 812.25);
+    EXPECT_EQ(rec.sequence_num, 8u);
+
+    EXPECT_FALSE(reader.next(rec));
+    EXPECT_EQ(reader.skipped(), 2u);
+}
+
+TEST(ReplayReader, ParsesLegacyCsvLog) {
+    replayReader reader("Press-Sensor 300.5 1736503200000 1\n\nPress-Sensor 301 1736503200100 2\nbad line\n");
+    replayRecord rec;
+    std::vector<uint32_t> seqs;
+    while (reader.next(rec)) seqs.push_back(rec.sequence_num);
+    EXPECT_EQ(seqs, (std::vector<uint32_t>{1, 2}));
+    EXPECT_EQ(reader.skipped(), 1u);
+}
+
+TEST(MappedFile, MapsFileContents) {
+    const std::string path = testing::TempDir() + "replay_reader_test.log";
+    {
+        std::ofstream out(path);
+        out << "Temp-Sensor 20.5 1000 0\nTemp-Sensor 21.5 1100 1\n";
+    }
+    {
+        mappedFile file(path);
+        replayReader reader(file.view());
+        replayRecord rec;
+        int records = 0;
+        while (reader.next(rec)) records++;
+        EXPECT_EQ(records, 2);
+    }
+    std::remove(path.c_str());
+    EXPECT_THROW(mappedFile{path}, std::system_error);
+}
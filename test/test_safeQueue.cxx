@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 #include <thread>
+#include <atomic>
+#include <vector>
 #include "../utilites/safe_queue.h"
 
 struct TestMsg {
@@ -27,17 +29,175 @@ TEST(ChannelQueue, ProducerConsumer) {
 
     // Consumer thread
     std::thread consumer([&q] {
-        TestMsg msg;
-        int count = 0;
+        uint32_t count = 0;
         while (count < 10) {
-            if (q.try_pop(msg)) {
-                EXPECT_EQ(msg.sensor_id, "TestSensor");
-                EXPECT_EQ(msg.sequence_num, count);
-                count++;
-            }
+            auto msg = q.pop();
+            ASSERT_TRUE(msg.has_value());
+            EXPECT_EQ(msg->sensor_id, "TestSensor");
+            EXPECT_EQ(msg->sequence_num, count);
+            count++;
         }
     });
 
     producer.join();
     consumer.join();
 }
+
+TEST(ChannelQueue, PopForTimesOutWhenEmpty) {
+    safeQueue<TestMsg> q;
+    auto start = std::chrono::steady_clock::now();
+    auto msg = q.pop_for(std::chrono::milliseconds(20));
+    EXPECT_FALSE(msg.has_value());
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(20));
+
+    q.push_in_queue(TestMsg{"TestSensor", 1.0, 1000, 0});
+    msg = q.pop_for(std::chrono::milliseconds(20));
+    ASSERT_TRUE(msg.has_value());
+    EXPECT_EQ(msg->sequence_num, 0u);
+}
+
+TEST(ChannelQueue, CloseWakesBlockedConsumer) {
+    safeQueue<TestMsg> q;
+    std::thread consumer([&q] {
+        auto msg = q.pop();
+        EXPECT_FALSE(msg.has_value());
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    q.close();
+    consumer.join();
+    EXPECT_TRUE(q.closed());
+}
+
+TEST(ChannelQueue, SharedNotifierWakesOnAnyQueue) {
+    queueNotifier notifier;
+    safeQueue<TestMsg> temp, pressure;
+    temp.attach_notifier(&notifier);
+    pressure.attach_notifier(&notifier);
+
+    const uint64_t seen = notifier.epoch();
+    EXPECT_FALSE(notifier.wait_for(seen, std::chrono::milliseconds(5)));
+
+    std::thread producer([&pressure] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        pressure.push_in_queue(TestMsg{"Pressure", 2.0, 1000, 0});
+    });
+
+    EXPECT_TRUE(notifier.wait_for(seen, std::chrono::seconds(5)));
+    TestMsg msg;
+    EXPECT_FALSE(temp.try_pop(msg));
+    EXPECT_TRUE(pressure.try_pop(msg));
+    producer.join();
+}
+
+TEST(ChannelQueue, BulkPushAndDrain) {
+    safeQueue<TestMsg> q;
+    std::vector<TestMsg> batch;
+    for (uint32_t i = 0; i < 10; ++i) {
+        batch.push_back(TestMsg{"TestSensor", i * 1.1, 1000 + i, i});
+    }
+    q.push_bulk(batch);
+    EXPECT_EQ(q.size(), 10u);
+
+    std::vector<TestMsg> out;
+    EXPECT_EQ(q.drain_into(out, 4), 4u);
+    EXPECT_EQ(q.drain_into(out), 6u);
+    EXPECT_EQ(q.drain_into(out), 0u);
+    ASSERT_EQ(out.size(), 10u);
+    for (uint32_t i = 0; i < 10; ++i) {
+        EXPECT_EQ(out[i].sequence_num, i);
+    }
+}
+
+TEST(ChannelQueue, DropNewestRejectsWhenFull) {
+    safeQueue<TestMsg> q(2, overflowPolicy::DropNewest);
+    EXPECT_TRUE(q.push_in_queue(TestMsg{"Temp", 1.0, 1000, 0}));
+    EXPECT_TRUE(q.push_in_queue(TestMsg{"Temp", 2.0, 1001, 1}));
+    EXPECT_FALSE(q.push_in_queue(TestMsg{"Temp", 3.0, 1002, 2}));
+
+    auto msg = q.pop_from_queue();
+    ASSERT_TRUE(msg.has_value());
+    EXPECT_EQ(msg->sequence_num, 0u);
+    EXPECT_EQ(q.stats().dropped, 1u);
+    EXPECT_EQ(q.stats().high_water, 2u);
+}
+
+TEST(ChannelQueue, DropOldestEvictsHead) {
+    safeQueue<TestMsg> q(2, overflowPolicy::DropOldest);
+    for (uint32_t i = 0; i < 5; ++i) {
+        EXPECT_TRUE(q.push_in_queue(TestMsg{"Temp", 1.0, 1000 + i, i}));
+    }
+
+    std::vector<TestMsg> out;
+    q.drain_into(out);
+    ASSERT_EQ(out.size(), 2u);
+    EXPECT_EQ(out[0].sequence_num, 3u);
+    EXPECT_EQ(out[1].sequence_num, 4u);
+    EXPECT_EQ(q.stats().dropped, 3u);
+}
+
+TEST(ChannelQueue, OverwriteLatestReplacesSameKey) {
+    safeQueue<TestMsg> q(3, overflowPolicy::OverwriteLatest);
+    q.set_key_matcher([](const TestMsg& a, const TestMsg& b){ return a.sensor_id == b.sensor_id; });
+    q.push_in_queue(TestMsg{"Temp", 1.0, 1000, 0});
+    q.push_in_queue(TestMsg{"Pressure", 2.0, 1000, 0});
+    q.push_in_queue(TestMsg{"Temp", 3.0, 1100, 1});
+    // Full: the newest queued Temp reading is replaced, Pressure survives
+    q.push_in_queue(TestMsg{"Temp", 4.0, 1200, 2});
+
+    std::vector<TestMsg> out;
+    q.drain_into(out);
+    ASSERT_EQ(out.size(), 3u);
+    EXPECT_EQ(out[0].sequence_num, 0u);
+    EXPECT_EQ(out[1].sensor_id, "Pressure");
+    EXPECT_EQ(out[2].sequence_num, 2u);
+    EXPECT_EQ(q.stats().dropped, 1u);
+}
+
+TEST(ChannelQueue, BlockWaitsForSpace) {
+    safeQueue<TestMsg> q(1, overflowPolicy::Block);
+    q.push_in_queue(TestMsg{"Temp", 1.0, 1000, 0});
+
+    std::atomic<bool> pushed{false};
+    std::thread producer([&] {
+        q.push_in_queue(TestMsg{"Temp", 2.0, 1001, 1});
+        pushed = true;
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_FALSE(pushed);
+    auto msg = q.pop();
+    ASSERT_TRUE(msg.has_value());
+    producer.join();
+    EXPECT_TRUE(pushed);
+    EXPECT_EQ(q.size(), 1u);
+
+    const queueStatsSnapshot stats = q.stats();
+    EXPECT_EQ(stats.pushed, 2u);
+    EXPECT_EQ(stats.popped, 1u);
+    EXPECT_EQ(stats.dropped, 0u);
+    EXPECT_GE(stats.dwell_max_ns, 20 * 1000 * 1000);
+}
+
+TEST(ChannelQueue, BlockBulkPushLargerThanCapacity) {
+    safeQueue<TestMsg> q(4, overflowPolicy::Block);
+    std::vector<TestMsg> batch;
+    for (uint32_t i = 0; i < 10; ++i) batch.push_back(TestMsg{"Temp", double(i), 1000 + i, i});
+
+    // The consumer is already parked in pop() when the batch fills the queue
+    std::vector<uint32_t> seen;
+    std::thread consumer([&] {
+        for (int i = 0; i < 10; ++i) {
+            auto msg = q.pop();
+            ASSERT_TRUE(msg.has_value());
+            seen.push_back(msg->sequence_num);
+        }
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    EXPECT_EQ(q.push_bulk(batch), 10u);
+    consumer.join();
+    ASSERT_EQ(seen.size(), 10u);
+    for (uint32_t i = 0; i < 10; ++i) EXPECT_EQ(seen[i], i);
+    EXPECT_EQ(q.stats().dropped, 0u);
+}
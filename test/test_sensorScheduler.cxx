@@ -0,0 +1,158 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <thread>
+#include <vector>
+#include "src/common/utilities/timer_wheel.h"
+#include "src/common/utilities/sensor_scheduler.h"
+
+TEST(TimerWheel, FiresEveryTimerOnItsTickAcrossLevels) {
+    timerWheel<int> wheel(1000);
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<uint64_t> offset(1, 300000);   // spans three levels
+    std::vector<uint64_t> expiry(2000);
+    for (int i = 0; i < 2000; ++i) {
+        expiry[i] = 1000 + offset(rng);
+        wheel.schedule(i, expiry[i]);
+    }
+
+    std::vector<uint64_t> fired_at(2000, 0);
+    size_t fired = 0;
+    for (uint64_t t = 1000; t <= 1000 + 300000; t += 997) {
+        fired += wheel.advance(t, [&](int id){ fired_at[id] = wheel.now(); });
+    }
+    fired += wheel.advance(1000 + 300001, [&](int id){ fired_at[id] = wheel.now(); });
+
+    EXPECT_EQ(fired, 2000u);
+    EXPECT_EQ(wheel.size(), 0u);
+    for (int i = 0; i < 2000; ++i) EXPECT_EQ(fired_at[i], expiry[i]) << "timer " << i;
+}
+
+TEST(TimerWheel, PastAndFarFutureTimers) {
+    timerWheel<int> wheel(500);
+    std::vector<int> order;
+    wheel.schedule(1, 10);                       // already due: next tick
+    wheel.schedule(2, 500 + (uint64_t(1) << 26)); // beyond the top level
+    wheel.advance(501, [&](int id){ order.push_back(id); });
+    EXPECT_EQ(order, std::vector<int>{1});
+
+    wheel.advance(500 + (uint64_t(1) << 26) - 1, [&](int id){ order.push_back(id); });
+    EXPECT_EQ(order.size(), 1u);
+    wheel.advance(500 + (uint64_t(1) << 26), [&](int id){ order.push_back(id); });
+    EXPECT_EQ(order, (std::vector<int>{1, 2}));
+}
+
+TEST(TimerWheel, CallbackCanReschedule) {
+    timerWheel<int> wheel(0);
+    int fired = 0;
+    wheel.schedule(0, 5);
+    wheel.advance(100, [&](int id){
+        fired++;
+        wheel.schedule(id, wheel.now() + 5);
+    });
+    EXPECT_EQ(fired, 20);
+    EXPECT_EQ(wheel.size(), 1u);
+}
+
+TEST(TimerWheel, NextDueIsFirstOccupiedSlot) {
+    timerWheel<int> wheel(1000);
+    EXPECT_EQ(wheel.next_due(), timerWheel<int>::NO_TIMER);
+
+    wheel.schedule(1, 1040);          // level 0: exact
+    EXPECT_EQ(wheel.next_due(), 1040u);
+
+    wheel.schedule(2, 1030);
+    EXPECT_EQ(wheel.next_due(), 1030u);
+
+    // Level 1 and up report the cascade of their slot, which is no later than the timer
+    timerWheel<int> far(1000);
+    far.schedule(3, 5000);
+    EXPECT_EQ(far.next_due(), 4992u);   // 5000 rounded down to a 64-tick slot
+    std::vector<int> fired;
+    far.advance(far.next_due(), [&](int id){ fired.push_back(id); });
+    EXPECT_TRUE(fired.empty());
+    EXPECT_EQ(far.next_due(), 5000u);
+    far.advance(far.next_due(), [&](int id){ fired.push_back(id); });
+    EXPECT_EQ(fired, std::vector<int>{3});
+    EXPECT_EQ(far.next_due(), timerWheel<int>::NO_TIMER);
+}
+
+TEST(SensorScheduler, FiresAtAbsoluteDeadlinesPerChannel) {
+    sensorScheduler scheduler(2, 1000000);
+    const int64_t periods_ms[] = {5, 10, 20};
+    std::vector<std::atomic<int>> counts(3);
+    std::vector<int64_t> last_deadline(3, 0);
+    std::atomic<bool> irregular{false};
+    for (size_t i = 0; i < 3; ++i) {
+        const int64_t period_ns = periods_ms[i] * 1000000;
+        scheduler.add_channel(period_ns, [&, i, period_ns](int64_t deadline_ns){
+            if (last_deadline[i] != 0 && (deadline_ns - last_deadline[i]) % period_ns != 0) irregular = true;
+            last_deadline[i] = deadline_ns;
+            counts[i]++;
+            return true;
+        }, i);
+    }
+
+    scheduler.start();
+    std::this_thread::sleep_for(std::chrono::milliseconds(400));
+    scheduler.stop();
+
+    EXPECT_FALSE(irregular);
+    // Generous bounds: the check is rate, not timing precision on a loaded machine
+    EXPECT_GT(counts[0].load(), 40);
+    EXPECT_LE(counts[0].load(), 82);
+    EXPECT_GT(counts[1].load(), 20);
+    EXPECT_LE(counts[1].load(), 41);
+    EXPECT_GT(counts[2].load(), 10);
+    EXPECT_LE(counts[2].load(), 21);
+    for (size_t i = 0; i < 3; ++i) {
+        const auto stats = scheduler.stats(i);
+        EXPECT_EQ(stats.fired, static_cast<uint64_t>(counts[i].load()));
+        EXPECT_EQ(stats.jitter.count, stats.fired);
+    }
+}
+
+TEST(SensorScheduler, ChannelStopsWhenCallbackReturnsFalse) {
+    sensorScheduler scheduler(1, 1000000);
+    std::atomic<int> fired{0};
+    scheduler.add_channel(2000000, [&](int64_t){ return ++fired < 3; }, 0);
+    scheduler.start();
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(fired.load(), 3);
+    scheduler.stop();
+}
+
+TEST(SensorScheduler, SleepsUntilNextDeadline) {
+    sensorScheduler scheduler(1, 1000000);
+    std::atomic<int> fired{0};
+    // 100 ms period on a 1 ms tick: a few wakeups per sample, not one per tick
+    scheduler.add_channel(100000000, [&](int64_t){ ++fired; return true; }, 0);
+    scheduler.start();
+    std::this_thread::sleep_for(std::chrono::milliseconds(350));
+
+    // stop() wakes the worker without waiting for the next deadline
+    const auto stop_started = std::chrono::steady_clock::now();
+    scheduler.stop();
+    EXPECT_LT(std::chrono::steady_clock::now() - stop_started, std::chrono::milliseconds(50));
+    EXPECT_GE(fired.load(), 3);
+    EXPECT_LE(scheduler.wakeups(), 4u * static_cast<uint64_t>(fired.load()) + 4);
+}
+
+TEST(SensorScheduler, ManyChannelsOnFewWorkers) {
+    sensorScheduler scheduler(2, 1000000);
+    const size_t channels = 10000;
+    std::atomic<uint64_t> fired{0};
+    for (size_t i = 0; i < channels; ++i) {
+        // 50 ms period, phases spread over the period
+        scheduler.add_channel(50000000, [&](int64_t){ fired.fetch_add(1, std::memory_order_relaxed); return true; },
+                              i, static_cast<int64_t>(i % 50) * 1000000);
+    }
+    scheduler.start();
+    std::this_thread::sleep_for(std::chrono::milliseconds(260));
+    scheduler.stop();
+    // Roughly five rounds of every channel
+    EXPECT_GE(fired.load(), 3 * channels);
+    EXPECT_LE(fired.load(), 7 * channels);
+}
@@ -1,6 +1,11 @@
 #include <iostream>
+#include <limits>
 #include <gtest/gtest.h>
 #include "sensor.pb.h"
+#include "src/Serializer/frame_decoder.h"
+#include "src/Serializer/frame_codec.h"
+#include "src/Serializer/schema_codec.h"
+#include "src/common/utilities/channel_registry.h"
 
 TEST(Serialization, RoundTrip){
     sensor_proto::proto_serial_data a;
@@ -19,4 +24,175 @@ TEST(Serialization, RoundTrip){
     EXPECT_DOUBLE_EQ(b.value(), 42.5);
     EXPECT_EQ(b.timestamp(), 123456);
     EXPECT_EQ(b.sequence_num(), 7);
-}
\ No newline at end of file
+}
+TEST(Serialization, FrameRoundTrip){
+    sensor_proto::proto_frame frame;
+    frame.add_sensors("Temp-Sensor");
+    frame.add_sensors("Press-Sensor");
+    for (int i = 0; i < 100; ++i) {
+        frame.add_sensor_index(i % 2);
+        frame.add_value(20.0 + i);
+        frame.add_timestamp(1736503200000 + i * 10);
+        frame.add_sequence_num(i / 2);
+    }
+
+    std::string buf;
+    ASSERT_TRUE(frame.SerializeToString(&buf));
+
+    sensor_proto::proto_frame back;
+    ASSERT_TRUE(back.ParseFromString(buf));
+    ASSERT_EQ(back.sensors_size(), 2);
+    ASSERT_EQ(back.value_size(), 100);
+    EXPECT_EQ(back.sensors(back.sensor_index(51)), "Press-Sensor");
+    EXPECT_DOUBLE_EQ(back.value(51), 71.0);
+    EXPECT_EQ(back.timestamp(51), 1736503200510);
+    EXPECT_EQ(back.sequence_num(51), 25);
+
+    // The sensor id is sent once per frame instead of once per reading
+    sensor_proto::proto_serial_data single;
+    single.set_sensor_id("Press-Sensor");
+    single.set_value(71.0);
+    single.set_timestamp(1736503200510);
+    single.set_sequence_num(25);
+    EXPECT_LT(buf.size(), 100 * single.ByteSizeLong());
+}
+
+TEST(Serialization, ChannelIdFramesUseDictionary){
+    channelRegistry registry;
+    const uint32_t temp = registry.intern("Temp-Sensor");
+    const uint32_t press = registry.intern("Press-Sensor");
+    EXPECT_EQ(registry.intern("Temp-Sensor"), temp);
+    EXPECT_EQ(registry.size(), 2u);
+
+    // No names in the frame: sensor_index carries the registry id
+    sensor_proto::proto_frame frame;
+    for (int i = 0; i < 10; ++i) {
+        frame.add_sensor_index(i % 2 ? press : temp);
+        frame.add_value(i);
+        frame.add_timestamp(1736503200000 + i);
+        frame.add_sequence_num(i / 2);
+    }
+    const std::string buf = frame.SerializeAsString();
+    const auto* bytes = reinterpret_cast<const uint8_t*>(buf.data());
+
+    frameDecoder decoder;
+    std::vector<sensorRecord> records;
+    ASSERT_TRUE(decoder.decode(bytes, buf.size(), records));
+    ASSERT_EQ(records.size(), 10u);
+    const uint32_t press_slot = records[1].sensor;
+    EXPECT_EQ(decoder.name(press_slot), "channel-1");
+
+    // The dictionary arriving late renames the channel without changing its slot
+    for (uint32_t id = 0; id < registry.size(); ++id) {
+        EXPECT_TRUE(decoder.define_channel(id, registry.name(id)));
+    }
+    ASSERT_TRUE(decoder.decode(bytes, buf.size(), records));
+    EXPECT_EQ(records[1].sensor, press_slot);
+    EXPECT_EQ(decoder.name(press_slot), "Press-Sensor");
+    EXPECT_EQ(decoder.name(records[0].sensor), "Temp-Sensor");
+    EXPECT_EQ(decoder.sensor_count(), 2u);
+
+    // Without the name list the frame is smaller still
+    sensor_proto::proto_frame named = frame;
+    named.clear_sensor_index();
+    named.add_sensors("Temp-Sensor");
+    named.add_sensors("Press-Sensor");
+    for (int i = 0; i < 10; ++i) named.add_sensor_index(i % 2);
+    EXPECT_LT(frame.ByteSizeLong(), named.ByteSizeLong());
+}
+
+TEST(Serialization, SchemaCodecMatchesGeneratedCode){
+    static_assert(readingSchema::fixed_size && readingSchema::max_size == 32, "fixed 32-byte reading");
+
+    // With every field non-zero the schema codec writes exactly what protobuf writes
+    for (const frameReading r : {frameReading{7, 21.5, 1736503200000, 42},
+                                 frameReading{0xffffffffu, -1e300, -1, std::numeric_limits<int64_t>::max()}}) {
+        uint8_t bytes[readingSchema::max_size];
+        ASSERT_EQ(readingSchema::encode(r, bytes), sizeof bytes);
+
+        sensor_proto::proto_reading generated;
+        generated.set_channel(r.channel);
+        generated.set_value(r.value);
+        generated.set_timestamp(r.timestamp);
+        generated.set_sequence_num(r.sequence_num);
+        EXPECT_EQ(std::string(reinterpret_cast<const char*>(bytes), sizeof bytes), generated.SerializeAsString());
+
+        sensor_proto::proto_reading parsed;
+        ASSERT_TRUE(parsed.ParseFromArray(bytes, sizeof bytes));
+        EXPECT_EQ(parsed.channel(), r.channel);
+        EXPECT_EQ(parsed.value(), r.value);
+        EXPECT_EQ(parsed.timestamp(), r.timestamp);
+        EXPECT_EQ(parsed.sequence_num(), r.sequence_num);
+    }
+
+    // Protobuf leaves zero fields out; the schema decoder falls back to reading tags
+    sensor_proto::proto_reading sparse;
+    sparse.set_sequence_num(9);
+    sparse.set_channel(3);
+    const std::string sparse_bytes = sparse.SerializeAsString();
+    frameReading decoded{1, 1.0, 1, 1};
+    ASSERT_TRUE(readingSchema::decode(reinterpret_cast<const uint8_t*>(sparse_bytes.data()), sparse_bytes.size(), decoded));
+    EXPECT_EQ(decoded.channel, 3u);
+    EXPECT_EQ(decoded.value, 0.0);
+    EXPECT_EQ(decoded.timestamp, 0);
+    EXPECT_EQ(decoded.sequence_num, 9);
+    EXPECT_FALSE(readingSchema::decode(reinterpret_cast<const uint8_t*>(sparse_bytes.data()), sparse_bytes.size() - 1, decoded));
+}
+
+// proto_serial_data's numeric fields with varint encodings; the string field is left out
+struct varintReading {
+    double value;
+    int64_t timestamp;
+    int64_t sequence_num;
+};
+using varintReadingSchema = recordSchema<
+    schemaField<2, &varintReading::value, wireType::Fixed64>,
+    schemaField<3, &varintReading::timestamp, wireType::Varint>,
+    schemaField<4, &varintReading::sequence_num, wireType::Varint>>;
+
+TEST(Serialization, SchemaCodecVarintFields){
+    static_assert(!varintReadingSchema::fixed_size, "varint fields have no fixed size");
+
+    const varintReading r{42.5, 1736503200000, -7};
+    uint8_t bytes[varintReadingSchema::max_size];
+    const size_t size = varintReadingSchema::encode(r, bytes);
+
+    sensor_proto::proto_serial_data generated;
+    generated.set_value(r.value);
+    generated.set_timestamp(r.timestamp);
+    generated.set_sequence_num(r.sequence_num);
+    EXPECT_EQ(std::string(reinterpret_cast<const char*>(bytes), size), generated.SerializeAsString());
+
+    // Unknown fields (here sensor_id) are skipped
+    generated.set_sensor_id("Temp-Sensor");
+    const std::string with_id = generated.SerializeAsString();
+    varintReading decoded{};
+    ASSERT_TRUE(varintReadingSchema::decode(reinterpret_cast<const uint8_t*>(with_id.data()), with_id.size(), decoded));
+    EXPECT_EQ(decoded.value, r.value);
+    EXPECT_EQ(decoded.timestamp, r.timestamp);
+    EXPECT_EQ(decoded.sequence_num, r.sequence_num);
+}
+
+TEST(Serialization, SchemaFramesParseAsProtoFrame){
+    frameEncoder encoder(frameCodec::Schema);
+    for (int i = 0; i < 20; ++i) encoder.add(i % 4, 20.0 + i, 1736503200000 + i * 100, i);
+    std::vector<uint8_t> bytes;
+    encoder.finish(bytes);
+    EXPECT_EQ(bytes.size(), 20 * frame_wire::SCHEMA_ENTRY);
+
+    sensor_proto::proto_frame frame;
+    ASSERT_TRUE(frame.ParseFromArray(bytes.data(), static_cast<int>(bytes.size())));
+    ASSERT_EQ(frame.readings_size(), 20);
+    EXPECT_EQ(frame.readings(13).channel(), 1u);
+    EXPECT_EQ(frame.readings(13).value(), 33.0);
+    EXPECT_EQ(frame.readings(13).timestamp(), 1736503201300);
+
+    // And a frame written by the generated code decodes through the schema path
+    const std::string generated = frame.SerializeAsString();
+    frameDecoder decoder(frameCodec::Schema);
+    std::vector<sensorRecord> records;
+    ASSERT_TRUE(decoder.decode(reinterpret_cast<const uint8_t*>(generated.data()), generated.size(), records));
+    ASSERT_EQ(records.size(), 20u);
+    EXPECT_EQ(records[0].sequence_num, 0);   // a zero field the generated code left out
+    EXPECT_EQ(records[19].value, 39.0);
+}
@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "src/common/utilities/sharded_aggregator.h"
+
+struct TestMsg {
+    uint32_t channel;
+    uint32_t sequence_num;
+};
+
+TEST(ShardedAggregator, PreservesPerChannelOrder) {
+    const size_t channels = 64;
+    const uint32_t per_channel = 500;
+    std::vector<uint32_t> next_seq(channels, 0);
+    std::atomic<uint64_t> out_of_order{0};
+    std::atomic<uint64_t> seen{0};
+
+    shardedAggregator<TestMsg> pool(4, [&](size_t, size_t channel, std::vector<TestMsg>& batch){
+        // A channel is only ever drained by one worker at a time, so this is race free
+        for (const auto& msg : batch) {
+            if (msg.channel != channel || msg.sequence_num != next_seq[channel]) out_of_order++;
+            next_seq[channel] = msg.sequence_num + 1;
+            seen++;
+        }
+    }, 128, 32);
+
+    for (size_t c = 0; c < channels; ++c) pool.add_channel(c);
+    pool.start();
+    for (uint32_t seq = 0; seq < per_channel; ++seq) {
+        for (size_t c = 0; c < channels; ++c) {
+            TestMsg msg{uint32_t(c), seq};
+            while (!pool.submit(c, std::move(msg))) std::this_thread::yield();
+        }
+    }
+    pool.stop();
+
+    EXPECT_EQ(seen.load(), uint64_t(channels) * per_channel);
+    EXPECT_EQ(out_of_order.load(), 0u);
+    uint64_t processed = 0;
+    for (size_t w = 0; w < pool.worker_count(); ++w) processed += pool.stats(w).processed;
+    EXPECT_EQ(processed, seen.load());
+}
+
+TEST(ShardedAggregator, NoItemLeftBehindUnderRelease) {
+    // Tiny batches and a trickling producer keep workers releasing channels just
+    // as new items arrive, the window where a wakeup could be lost
+    const size_t channels = 8;
+    const uint32_t per_channel = 20000;
+    std::atomic<uint64_t> seen{0};
+    shardedAggregator<TestMsg> pool(4, [&](size_t, size_t, std::vector<TestMsg>& batch){
+        seen += batch.size();
+    }, 64, 1);
+
+    for (size_t c = 0; c < channels; ++c) pool.add_channel(c);
+    pool.start();
+    for (uint32_t seq = 0; seq < per_channel; ++seq) {
+        for (size_t c = 0; c < channels; ++c) {
+            TestMsg msg{uint32_t(c), seq};
+            while (!pool.submit(c, std::move(msg))) std::this_thread::yield();
+        }
+    }
+
+    // Every item must be delivered without stop() having to sweep it up
+    const uint64_t total = uint64_t(channels) * per_channel;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (seen.load() < total && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(seen.load(), total);
+    pool.stop();
+
+    EXPECT_EQ(seen.load(), total);
+    for (size_t c = 0; c < channels; ++c) {
+        const queueStatsSnapshot stats = pool.channel_stats(c);
+        EXPECT_EQ(stats.pushed, per_channel) << c;
+        EXPECT_EQ(stats.popped, per_channel) << c;
+    }
+}
+
+TEST(ShardedAggregator, IdleWorkersStealFromBusyShard) {
+    const size_t channels = 16;
+    std::mutex mutex;
+    std::vector<size_t> worker_of_batch;
+
+    shardedAggregator<TestMsg> pool(4, [&](size_t worker, size_t, std::vector<TestMsg>&){
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        std::lock_guard<std::mutex> lock(mutex);
+        worker_of_batch.push_back(worker);
+    });
+
+    // Every key maps to worker 0, so the other workers only get work by stealing
+    for (size_t c = 0; c < channels; ++c) pool.add_channel(c * 4);
+    pool.start();
+    for (size_t c = 0; c < channels; ++c) {
+        TestMsg msg{uint32_t(c), 0};
+        ASSERT_TRUE(pool.submit(c, std::move(msg)));
+    }
+    pool.stop();
+
+    ASSERT_EQ(worker_of_batch.size(), channels);
+    uint64_t stolen = 0;
+    for (size_t w = 0; w < pool.worker_count(); ++w) stolen += pool.stats(w).stolen;
+    EXPECT_GT(stolen, 0u);
+}
@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <thread>
+#include <string>
+#include <vector>
+#include "src/common/utilities/spsc_ring_buffer.h"
+
+struct TestMsg {
+    std::string sensor_id;
+    double value;
+    uint64_t timestamp;
+    uint32_t sequence_num;
+};
+
+
+TEST(SpscRingBuffer, CapacityRoundsToPowerOfTwo) {
+    spscRingBuffer<int> q(100);
+    EXPECT_EQ(q.capacity(), 128);
+    EXPECT_TRUE(q.empty());
+}
+
+TEST(SpscRingBuffer, RejectsPushWhenFull) {
+    spscRingBuffer<int> q(4);
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(q.push_in_queue(i));
+    }
+    EXPECT_FALSE(q.push_in_queue(99));
+    EXPECT_EQ(q.size(), 4);
+
+    int out = -1;
+    ASSERT_TRUE(q.try_pop(out));
+    EXPECT_EQ(out, 0);
+    EXPECT_TRUE(q.push_in_queue(4));
+}
+
+TEST(SpscRingBuffer, ProducerConsumer) {
+    spscRingBuffer<TestMsg> q(64);
+    const uint32_t total = 10000;
+
+    // Producer thread
+    std::thread producer([&q] {
+        for (uint32_t i = 0; i < total; ++i) {
+            TestMsg msg{"TestSensor", i * 1.1, 1000 + i, i};
+            while (!q.push_in_queue(msg)) std::this_thread::yield();
+        }
+    });
+
+    // Consumer thread
+    std::thread consumer([&q] {
+        TestMsg msg;
+        uint32_t count = 0;
+        while (count < total) {
+            if (q.try_pop(msg)) {
+                ASSERT_EQ(msg.sequence_num, count);
+                EXPECT_EQ(msg.sensor_id, "TestSensor");
+                count++;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    producer.join();
+    consumer.join();
+    EXPECT_TRUE(q.empty());
+}
+
+TEST(SpscRingBuffer, BulkPushStopsAtCapacity) {
+    spscRingBuffer<int> q(8);
+    std::vector<int> batch{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    EXPECT_EQ(q.push_bulk(batch), 8u);
+
+    std::vector<int> out;
+    EXPECT_EQ(q.drain_into(out, 3), 3u);
+    EXPECT_EQ(q.push_bulk(std::vector<int>{8, 9}), 2u);
+    EXPECT_EQ(q.drain_into(out), 7u);
+    ASSERT_EQ(out.size(), 10u);
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_EQ(out[i], i);
+    }
+}
+
+TEST(SpscRingBuffer, CountsDropsAndDepth) {
+    spscRingBuffer<int> q(4);
+    EXPECT_EQ(q.push_bulk(std::vector<int>{0, 1, 2, 3, 4, 5}), 4u);
+    EXPECT_FALSE(q.push_in_queue(6));
+
+    std::vector<int> out;
+    q.drain_into(out);
+    const queueStatsSnapshot stats = q.stats();
+    EXPECT_EQ(stats.pushed, 4u);
+    EXPECT_EQ(stats.popped, 4u);
+    EXPECT_EQ(stats.dropped, 3u);
+    EXPECT_EQ(stats.high_water, 4u);
+}
+
+TEST(SpscRingBuffer, SamplesDwellTime) {
+    spscRingBuffer<int> q(256);
+    // Position 0 is sampled; it sits in the queue while the rest go through
+    ASSERT_TRUE(q.push_in_queue(0));
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    int value;
+    ASSERT_TRUE(q.try_pop(value));
+    for (int i = 1; i < static_cast<int>(spscQueueStats::DWELL_SAMPLE) * 2; ++i) {
+        ASSERT_TRUE(q.push_in_queue(i));
+        ASSERT_TRUE(q.try_pop(value));
+    }
+
+    const queueStatsSnapshot stats = q.stats();
+    EXPECT_EQ(stats.pushed, spscQueueStats::DWELL_SAMPLE * 2);
+    EXPECT_EQ(stats.popped, spscQueueStats::DWELL_SAMPLE * 2);
+    EXPECT_GE(stats.dwell_max_ns, 5 * 1000 * 1000);
+    EXPECT_GT(stats.dwell_avg_ns, 0.0);
+}
+
+TEST(SpscRingBuffer, ConsumeInPlaceKeepsSlotStorage) {
+    spscRingBuffer<std::vector<int>> q(2);
+    for (int round = 0; round < 4; ++round) {
+        ASSERT_TRUE(q.push_with([&](std::vector<int>& slot){ slot.assign(100, round); }));
+        size_t seen = q.consume([&](std::vector<int>& slot){
+            EXPECT_EQ(slot.size(), 100u);
+            EXPECT_EQ(slot.front(), round);
+        });
+        EXPECT_EQ(seen, 1u);
+    }
+    // Both slots were filled and consumed in place, so they still own their buffers
+    EXPECT_TRUE(q.push_with([](std::vector<int>& slot){ EXPECT_GE(slot.capacity(), 100u); }));
+}
@@ -0,0 +1,185 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include "src/common/utilities/time_window.h"
+
+struct flushedWindow {
+    int64_t start;
+    std::vector<int> items;
+};
+
+TEST(TimeWindow, FlushesOnlyCompleteWindows) {
+    timeWindowEngine<int> engine(1000, 200);
+    std::vector<flushedWindow> out;
+    auto collect = [&](int64_t start, std::vector<int>& items){ out.push_back({start, items}); };
+
+    engine.insert(1, 1000);
+    engine.insert(2, 1500);
+    engine.insert(3, 1999);
+    EXPECT_EQ(engine.flush_ready(collect), 0u);
+
+    // Watermark 2100 is inside the lateness of window [1000,2000)
+    engine.insert(4, 2100);
+    EXPECT_EQ(engine.flush_ready(collect), 0u);
+
+    engine.insert(5, 2200);
+    EXPECT_EQ(engine.flush_ready(collect), 1u);
+    ASSERT_EQ(out.size(), 1u);
+    EXPECT_EQ(out[0].start, 1000);
+    EXPECT_EQ(out[0].items, (std::vector<int>{1, 2, 3}));
+    EXPECT_EQ(engine.pending(), 2u);
+}
+
+TEST(TimeWindow, AcceptsLateDataWithinLatenessAndDropsAfterFlush) {
+    timeWindowEngine<int> engine(1000, 500);
+    std::vector<flushedWindow> out;
+    auto collect = [&](int64_t start, std::vector<int>& items){ out.push_back({start, items}); };
+
+    engine.insert(1, 1100);
+    engine.insert(2, 2300);
+    EXPECT_TRUE(engine.insert(3, 1900));   // late but inside the lateness
+    engine.insert(4, 2600);
+    engine.flush_ready(collect);
+    ASSERT_EQ(out.size(), 1u);
+    EXPECT_EQ(out[0].items, (std::vector<int>{1, 3}));
+
+    EXPECT_FALSE(engine.insert(5, 1950));  // window already flushed
+    EXPECT_EQ(engine.late_dropped(), 1u);
+}
+
+TEST(TimeWindow, AcceptsOutOfOrderFirstArrival) {
+    timeWindowEngine<int> engine(1000, 1000);
+    std::vector<flushedWindow> out;
+    auto collect = [&](int64_t start, std::vector<int>& items){ out.push_back({start, items}); };
+
+    // The first item is not the oldest; the one behind it is within the lateness
+    engine.insert(1, 2500);
+    EXPECT_TRUE(engine.insert(2, 1800));
+    engine.insert(3, 3600);
+    EXPECT_EQ(engine.flush_ready(collect), 1u);
+    ASSERT_EQ(out.size(), 1u);
+    EXPECT_EQ(out[0].start, 1000);
+    EXPECT_EQ(out[0].items, (std::vector<int>{2}));
+
+    engine.insert(4, 4100);
+    EXPECT_EQ(engine.flush_ready(collect), 1u);
+    ASSERT_EQ(out.size(), 2u);
+    EXPECT_EQ(out[1].start, 2000);
+    EXPECT_EQ(out[1].items, (std::vector<int>{1}));
+
+    EXPECT_FALSE(engine.insert(5, 1500));
+    EXPECT_EQ(engine.late_dropped(), 1u);
+}
+
+TEST(TimeWindow, LargeJumpKeepsWindowOrder) {
+    timeWindowEngine<int> engine(100, 0);
+    std::vector<flushedWindow> out;
+    auto collect = [&](int64_t start, std::vector<int>& items){ out.push_back({start, items}); };
+
+    // Spans far more windows than the ring holds without an intermediate flush
+    for (int i = 0; i < 20; ++i) {
+        engine.insert(int(i), int64_t(i) * 100);
+    }
+    engine.flush_all(collect);
+
+    ASSERT_EQ(out.size(), 20u);
+    for (int i = 0; i < 20; ++i) {
+        EXPECT_EQ(out[i].start, int64_t(i) * 100);
+        EXPECT_EQ(out[i].items, (std::vector<int>{i}));
+    }
+    EXPECT_EQ(engine.pending(), 0u);
+}
+
+TEST(TimeWindow, BacklogIsLinear) {
+    timeWindowEngine<int> engine(1000, 200);
+    size_t flushed_items = 0;
+    auto count = [&](int64_t, std::vector<int>& items){ flushed_items += items.size(); };
+
+    // A stall-sized backlog: three sensors at 10 Hz for ~30 minutes
+    const int samples = 60000;
+    for (int i = 0; i < samples; ++i) {
+        engine.insert(int(i), 1000 + int64_t(i / 3) * 100);
+        if (i % 256 == 0) engine.flush_ready(count);
+    }
+    engine.flush_all(count);
+    EXPECT_EQ(flushed_items, size_t(samples));
+}
+
+TEST(TimeWindow, BatchSizeFlushesOpenWindow) {
+    windowFlushPolicy policy;
+    policy.max_batch = 3;
+    timeWindowEngine<int> engine(1000, 200, policy);
+    std::vector<flushedWindow> out;
+    auto collect = [&](int64_t start, std::vector<int>& items){ out.push_back({start, items}); };
+
+    engine.insert(1, 1000, 0);
+    engine.insert(2, 1100, 0);
+    EXPECT_EQ(engine.flush_due(0, collect), 0u);
+    engine.insert(3, 1200, 0);
+    EXPECT_EQ(engine.flush_due(0, collect), 1u);
+    ASSERT_EQ(out.size(), 1u);
+    EXPECT_EQ(out[0].items, (std::vector<int>{1, 2, 3}));
+
+    // The window stays open for the rest of its data
+    EXPECT_TRUE(engine.insert(4, 1300, 0));
+    EXPECT_EQ(engine.pending(), 1u);
+}
+
+TEST(TimeWindow, LatencyDeadlineFlushesOpenWindow) {
+    windowFlushPolicy policy;
+    policy.max_latency_ms = 50;
+    timeWindowEngine<int> engine(1000, 200, policy);
+    std::vector<flushedWindow> out;
+    auto collect = [&](int64_t start, std::vector<int>& items){ out.push_back({start, items}); };
+
+    EXPECT_EQ(engine.next_deadline_ms(), std::numeric_limits<int64_t>::max());
+    engine.insert(1, 1000, 10'000);
+    engine.insert(2, 1010, 10'020);
+    EXPECT_EQ(engine.next_deadline_ms(), 10'050);
+
+    EXPECT_EQ(engine.flush_due(10'049, collect), 0u);
+    EXPECT_EQ(engine.flush_due(10'050, collect), 1u);
+    ASSERT_EQ(out.size(), 1u);
+    EXPECT_EQ(out[0].items, (std::vector<int>{1, 2}));
+    EXPECT_EQ(engine.next_deadline_ms(), std::numeric_limits<int64_t>::max());
+}
+
+TEST(TimeWindow, EvictedWindowKeepsItsDeadlines) {
+    windowFlushPolicy policy;
+    policy.max_batch = 3;
+    policy.max_latency_ms = 50;
+    timeWindowEngine<int> engine(10, 100, policy);   // 16 buckets
+    std::vector<flushedWindow> out;
+    auto collect = [&](int64_t start, std::vector<int>& items){ out.push_back({start, items}); };
+
+    // Window 20 is still open when a straggler for window 4 takes its bucket
+    engine.insert(1, 200, 0);
+    engine.insert(2, 40, 5);
+    EXPECT_EQ(engine.pending(), 2u);
+    EXPECT_EQ(engine.next_deadline_ms(), 50);
+
+    // Window 4 is complete; the evicted window 20 is not due yet
+    EXPECT_EQ(engine.flush_due(49, collect), 1u);
+    ASSERT_EQ(out.size(), 1u);
+    EXPECT_EQ(out[0].start, 40);
+    EXPECT_EQ(engine.next_deadline_ms(), 50);
+
+    EXPECT_EQ(engine.flush_due(50, collect), 1u);
+    ASSERT_EQ(out.size(), 2u);
+    EXPECT_EQ(out[1].start, 200);
+    EXPECT_EQ(out[1].items, (std::vector<int>{1}));
+    EXPECT_EQ(engine.pending(), 0u);
+    EXPECT_EQ(engine.next_deadline_ms(), std::numeric_limits<int64_t>::max());
+
+    // A full evicted window goes out on the batch trigger, after the complete
+    // window that evicted it
+    for (int i = 0; i < 3; ++i) engine.insert(10 + i, 400, 60);
+    engine.insert(20, 240, 61);
+    EXPECT_EQ(engine.flush_due(62, collect), 2u);
+    ASSERT_EQ(out.size(), 4u);
+    EXPECT_EQ(out[2].start, 240);
+    EXPECT_EQ(out[3].start, 400);
+    EXPECT_EQ(out[3].items, (std::vector<int>{10, 11, 12}));
+    EXPECT_EQ(engine.pending(), 0u);
+}
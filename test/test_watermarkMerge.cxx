@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include "src/common/utilities/watermark_merge.h"
+
+struct mergedItem {
+    int source;
+    int64_t ts;
+};
+
+TEST(WatermarkMerge, WaitsForEverySourceBeforeReleasing) {
+    watermarkMerger<int> merger(3);
+    std::vector<int64_t> out;
+    auto collect = [&](int&&, int64_t ts){ out.push_back(ts); };
+
+    merger.push(0, 0, 100, 0);
+    merger.push(1, 1, 120, 0);
+    EXPECT_EQ(merger.pop_ready(collect), 0u);   // source 2 has said nothing yet
+
+    merger.push(2, 2, 110, 0);
+    EXPECT_EQ(merger.pop_ready(collect), 1u);   // 100 is safe; 110 waits on source 0
+    merger.push(0, 0, 130, 0);
+    merger.pop_ready(collect);
+    EXPECT_EQ(out, (std::vector<int64_t>{100, 110}));   // 120 waits on source 2
+
+    merger.push(2, 2, 125, 0);
+    merger.pop_ready(collect);
+    EXPECT_EQ(out, (std::vector<int64_t>{100, 110, 120}));
+    EXPECT_EQ(merger.buffered(), 2u);
+}
+
+TEST(WatermarkMerge, AdvanceReleasesWithoutData) {
+    watermarkMerger<int> merger(2);
+    std::vector<int64_t> out;
+    auto collect = [&](int&&, int64_t ts){ out.push_back(ts); };
+
+    merger.push(0, 0, 100, 0);
+    merger.push(0, 0, 200, 0);
+    merger.advance(1, 150, 0);
+    merger.pop_ready(collect);
+    EXPECT_EQ(out, (std::vector<int64_t>{100}));
+}
+
+TEST(WatermarkMerge, ClosedAndIdleSourcesDoNotBlock) {
+    watermarkMerger<int> merger(3, 500);
+    std::vector<int64_t> out;
+    auto collect = [&](int&&, int64_t ts){ out.push_back(ts); };
+
+    merger.push(0, 0, 100, 0);
+    merger.push(1, 1, 105, 0);
+    merger.close(2);                            // sensor stopped from the console
+    merger.pop_ready(collect);
+    EXPECT_EQ(out, (std::vector<int64_t>{100}));
+
+    // Source 0 goes quiet; after the idle timeout source 1 is no longer held back
+    merger.push(1, 1, 300, 200);
+    merger.expire_idle(400);
+    EXPECT_EQ(merger.pop_ready(collect), 0u);
+    merger.expire_idle(600);
+    merger.pop_ready(collect);
+    EXPECT_EQ(out, (std::vector<int64_t>{100, 105, 300}));
+
+    // An idle source that speaks again rejoins the merge
+    merger.push(0, 0, 400, 700);
+    merger.push(1, 1, 450, 700);
+    merger.pop_ready(collect);
+    EXPECT_EQ(out.back(), 400);
+}
+
+TEST(WatermarkMerge, ManySourcesProduceOrderedStream) {
+    const int sources = 200;
+    watermarkMerger<mergedItem> merger(sources);
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> step(1, 50);
+
+    std::vector<int64_t> next_ts(sources, 0);
+    std::vector<mergedItem> out;
+    auto collect = [&](mergedItem&& item, int64_t){ out.push_back(item); };
+
+    size_t pushed = 0;
+    for (int round = 0; round < 50; ++round) {
+        for (int s = 0; s < sources; ++s) {
+            next_ts[s] += step(rng);
+            merger.push(size_t(s), mergedItem{s, next_ts[s]}, next_ts[s], 0);
+            pushed++;
+        }
+        merger.pop_ready(collect);
+    }
+    merger.flush_all(collect);
+
+    ASSERT_EQ(out.size(), pushed);
+    EXPECT_TRUE(std::is_sorted(out.begin(), out.end(),
+                               [](const mergedItem& a, const mergedItem& b){ return a.ts < b.ts; }));
+}